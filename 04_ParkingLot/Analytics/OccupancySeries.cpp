@@ -0,0 +1,100 @@
+#include "OccupancySeries.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace Analytics {
+
+OccupancySeries::OccupancySeries(std::size_t bucketCount, int64_t bucketSeconds)
+    : bucketSeconds(bucketSeconds), ring(bucketCount), currentOccupied(0),
+      newestStart(std::numeric_limits<int64_t>::min()) {
+    if (bucketCount == 0 || bucketSeconds <= 0) {
+        throw std::invalid_argument("OccupancySeries: need at least one bucket of positive width");
+    }
+    for (auto& bucket : ring) {
+        bucket.bucketStart = -1;
+    }
+}
+
+void OccupancySeries::recordEntry(int64_t time, uint32_t occupiedAfter) {
+    if (OccupancyBucket* bucket = bucketFor(time)) {
+        bucket->entries++;
+        bucket->peakOccupied = std::max(bucket->peakOccupied, occupiedAfter);
+        bucket->lastOccupied = occupiedAfter;
+    }
+    currentOccupied = occupiedAfter;
+}
+
+void OccupancySeries::recordExit(int64_t time, uint32_t occupiedAfter) {
+    if (OccupancyBucket* bucket = bucketFor(time)) {
+        bucket->exits++;
+        bucket->lastOccupied = occupiedAfter;
+    }
+    currentOccupied = occupiedAfter;
+}
+
+std::vector<OccupancyBucket> OccupancySeries::snapshot(int64_t now) const {
+    std::vector<OccupancyBucket> series;
+    series.reserve(ring.size());
+    int64_t newest = startOf(now);
+    int64_t oldest = newest - bucketSeconds * static_cast<int64_t>(ring.size() - 1);
+    // Quiet buckets inherit the level the previous bucket ended at; before the
+    // first recorded bucket, the level that bucket started from
+    uint32_t carried = currentOccupied;
+    for (int64_t start = oldest; start <= newest; start += bucketSeconds) {
+        const OccupancyBucket& stored = ring[slotOf(start)];
+        if (stored.bucketStart == start) {
+            carried = stored.startOccupied;
+            break;
+        }
+    }
+    for (int64_t start = oldest; start <= newest; start += bucketSeconds) {
+        const OccupancyBucket& stored = ring[slotOf(start)];
+        OccupancyBucket bucket;
+        if (stored.bucketStart == start) {
+            bucket = stored;
+            carried = stored.lastOccupied;
+        } else {
+            bucket.bucketStart = start;
+            bucket.startOccupied = carried;
+            bucket.peakOccupied = carried;
+            bucket.lastOccupied = carried;
+        }
+        series.push_back(bucket);
+    }
+    return series;
+}
+
+OccupancyBucket* OccupancySeries::bucketFor(int64_t time) {
+    int64_t start = startOf(time);
+    // Late events older than the ring share a slot with a live bucket and
+    // would reset it; like RollingWindow, they are left out of the series
+    // (the occupancy they report is still the current level)
+    if (start < newestStart && newestStart - start >= bucketSeconds * static_cast<int64_t>(ring.size())) {
+        return nullptr;
+    }
+    newestStart = std::max(newestStart, start);
+    OccupancyBucket& bucket = ring[slotOf(start)];
+    if (bucket.bucketStart != start) {
+        // Reusing a slot from an older lap of the ring
+        bucket = OccupancyBucket();
+        bucket.bucketStart = start;
+        bucket.startOccupied = currentOccupied;
+        bucket.peakOccupied = currentOccupied;
+        bucket.lastOccupied = currentOccupied;
+    }
+    return &bucket;
+}
+
+int64_t OccupancySeries::startOf(int64_t time) const {
+    int64_t start = time - time % bucketSeconds;
+    return time < 0 && time % bucketSeconds != 0 ? start - bucketSeconds : start;
+}
+
+std::size_t OccupancySeries::slotOf(int64_t start) const {
+    int64_t size = static_cast<int64_t>(ring.size());
+    int64_t index = start / bucketSeconds;
+    return static_cast<std::size_t>(((index % size) + size) % size);
+}
+
+} // namespace Analytics
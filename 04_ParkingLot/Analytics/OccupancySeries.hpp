@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Analytics {
+
+struct OccupancyBucket {
+    int64_t bucketStart = 0;  // seconds since epoch
+    uint32_t startOccupied = 0;
+    uint32_t peakOccupied = 0;
+    uint32_t lastOccupied = 0;
+    uint32_t entries = 0;
+    uint32_t exits = 0;
+};
+
+// Rolling occupancy time series in a fixed ring of buckets. Each bucket is
+// tagged with its start time and reset in place when the ring wraps, so
+// recording never allocates. Not synchronised, like RollingWindow.
+class OccupancySeries {
+private:
+    int64_t bucketSeconds;
+    std::vector<OccupancyBucket> ring;
+    uint32_t currentOccupied;
+    int64_t newestStart;  // latest bucket recorded into
+
+public:
+    OccupancySeries(std::size_t bucketCount, int64_t bucketSeconds);
+
+    void recordEntry(int64_t time, uint32_t occupiedAfter);
+    void recordExit(int64_t time, uint32_t occupiedAfter);
+
+    // Buckets covering the window ending at `now`, oldest first, with
+    // quiet buckets filled in at the occupancy level of the time
+    std::vector<OccupancyBucket> snapshot(int64_t now) const;
+
+private:
+    // Null for events a full ring or more behind the newest bucket
+    OccupancyBucket* bucketFor(int64_t time);
+    int64_t startOf(int64_t time) const;
+    std::size_t slotOf(int64_t start) const;
+};
+
+} // namespace Analytics
@@ -0,0 +1,60 @@
+#include "RollingWindow.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Analytics {
+
+namespace {
+int64_t floorDiv(int64_t value, int64_t divisor) {
+    int64_t quotient = value / divisor;
+    return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+}
+}
+
+RollingWindow::RollingWindow(std::size_t bucketCount, int64_t bucketSeconds)
+    : bucketSeconds(bucketSeconds), buckets(bucketCount, 0), headBucket(0), runningTotal(0), started(false) {
+    if (bucketCount == 0 || bucketSeconds <= 0) {
+        throw std::invalid_argument("RollingWindow: need at least one bucket of positive width");
+    }
+}
+
+void RollingWindow::add(int64_t time, int64_t value) {
+    int64_t bucket = floorDiv(time, bucketSeconds);
+    advance(bucket);
+    // Late events older than the window only count towards lifetime totals elsewhere
+    if (bucket <= headBucket - static_cast<int64_t>(buckets.size())) {
+        return;
+    }
+    buckets[slotOf(bucket)] += value;
+    runningTotal += value;
+}
+
+int64_t RollingWindow::total(int64_t now) {
+    advance(floorDiv(now, bucketSeconds));
+    return runningTotal;
+}
+
+std::size_t RollingWindow::slotOf(int64_t bucket) const {
+    int64_t size = static_cast<int64_t>(buckets.size());
+    return static_cast<std::size_t>(((bucket % size) + size) % size);
+}
+
+void RollingWindow::advance(int64_t bucket) {
+    int64_t size = static_cast<int64_t>(buckets.size());
+    if (!started || bucket - headBucket >= size) {
+        // First event, or the whole window has expired at once
+        std::fill(buckets.begin(), buckets.end(), 0);
+        runningTotal = 0;
+        headBucket = bucket;
+        started = true;
+        return;
+    }
+    while (headBucket < bucket) {
+        headBucket++;
+        int64_t& expired = buckets[slotOf(headBucket)];
+        runningTotal -= expired;
+        expired = 0;
+    }
+}
+
+} // namespace Analytics
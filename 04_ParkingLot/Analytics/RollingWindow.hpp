@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Analytics {
+
+// Sum over the last bucketCount * bucketSeconds seconds, kept in a fixed
+// ring of buckets plus a running total. Expired buckets are subtracted as
+// time advances, so both add() and total() are amortised O(1).
+// Not synchronised: callers guard it with the lock of the data it tracks.
+class RollingWindow {
+private:
+    int64_t bucketSeconds;
+    std::vector<int64_t> buckets;
+    int64_t headBucket;  // absolute index of the newest bucket
+    int64_t runningTotal;
+    bool started;
+
+public:
+    RollingWindow(std::size_t bucketCount, int64_t bucketSeconds);
+
+    void add(int64_t time, int64_t value);
+    int64_t total(int64_t now);
+
+    int64_t getWindowSeconds() const { return bucketSeconds * static_cast<int64_t>(buckets.size()); }
+
+private:
+    void advance(int64_t bucket);
+    std::size_t slotOf(int64_t bucket) const;
+};
+
+} // namespace Analytics
@@ -0,0 +1,23 @@
+#include "ShardAnalytics.hpp"
+
+namespace Analytics {
+
+ShardAnalytics::ShardAnalytics(uint32_t capacity, std::size_t buckets, int64_t bucketSeconds)
+    : capacity(capacity), occupied(0), lifetimeRevenue(0), lifetimeEntries(0),
+      revenue(buckets, bucketSeconds), entries(buckets, bucketSeconds), occupancy(buckets, bucketSeconds) {}
+
+void ShardAnalytics::onEntry(int64_t time) {
+    occupied++;
+    lifetimeEntries++;
+    entries.add(time, 1);
+    occupancy.recordEntry(time, occupied);
+}
+
+void ShardAnalytics::onExit(int64_t time, int64_t feeCents) {
+    occupied--;
+    lifetimeRevenue += feeCents;
+    revenue.add(time, feeCents);
+    occupancy.recordExit(time, occupied);
+}
+
+} // namespace Analytics
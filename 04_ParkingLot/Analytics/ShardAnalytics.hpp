@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "RollingWindow.hpp"
+#include "OccupancySeries.hpp"
+
+namespace Analytics {
+
+// Incrementally maintained statistics for one (level, spot type) shard of
+// the lot, updated under the shard lock on every entry and exit so that
+// dashboard queries never scan spots or tickets.
+class ShardAnalytics {
+private:
+    uint32_t capacity;
+    uint32_t occupied;
+    int64_t lifetimeRevenue;
+    uint64_t lifetimeEntries;
+    RollingWindow revenue;
+    RollingWindow entries;
+    OccupancySeries occupancy;
+
+public:
+    // One-hour window in one-minute buckets by default
+    explicit ShardAnalytics(uint32_t capacity, std::size_t buckets = 60, int64_t bucketSeconds = 60);
+
+    void onEntry(int64_t time);
+    void onExit(int64_t time, int64_t feeCents);
+
+    int64_t revenueInWindow(int64_t now) { return revenue.total(now); }
+    int64_t entriesInWindow(int64_t now) { return entries.total(now); }
+    std::vector<OccupancyBucket> occupancySeries(int64_t now) const { return occupancy.snapshot(now); }
+
+    // Getters
+    uint32_t getCapacity() const { return capacity; }
+    uint32_t getOccupied() const { return occupied; }
+    int64_t getLifetimeRevenue() const { return lifetimeRevenue; }
+    uint64_t getLifetimeEntries() const { return lifetimeEntries; }
+};
+
+} // namespace Analytics
@@ -0,0 +1,77 @@
+#include "GateBenchmark.hpp"
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace Benchmark {
+
+GateBenchmarkResult runGateBenchmark(Controller::ParkingLot& lot, int gates, uint64_t operationsPerGate,
+                                     std::size_t holdPerGate, int64_t startTime) {
+    std::atomic<uint64_t> assignments{0};
+    std::atomic<uint64_t> releases{0};
+    std::atomic<uint64_t> rejected{0};
+    std::atomic<bool> start{false};
+
+    std::vector<std::thread> threads;
+    for (int gate = 0; gate < gates; gate++) {
+        threads.emplace_back([&, gate]() {
+            std::mt19937 rng(gate + 1);
+            std::uniform_int_distribution<int> vehicleRoll(0, 9);
+            std::deque<uint64_t> held;
+            uint64_t localAssigned = 0, localReleased = 0, localRejected = 0;
+            int gateLevel = gate % std::max(lot.getLevelCount(), 1);
+
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (uint64_t op = 0; op < operationsPerGate; op++) {
+                int roll = vehicleRoll(rng);
+                auto vehicle = roll < 2 ? CommonEnum::VehicleType::MOTORCYCLE
+                             : roll < 9 ? CommonEnum::VehicleType::CAR
+                                        : CommonEnum::VehicleType::TRUCK;
+                int64_t now = startTime + static_cast<int64_t>(op);
+                auto ticket = lot.park(vehicle, gateLevel, now);
+                if (ticket) {
+                    held.push_back(ticket->ticketId);
+                    localAssigned++;
+                } else {
+                    localRejected++;
+                }
+                if (held.size() > holdPerGate || (!ticket && !held.empty())) {
+                    if (lot.unpark(held.front(), now)) {
+                        localReleased++;
+                    }
+                    held.pop_front();
+                }
+            }
+            int64_t closing = startTime + static_cast<int64_t>(operationsPerGate);
+            for (uint64_t ticketId : held) {
+                if (lot.unpark(ticketId, closing)) {
+                    localReleased++;
+                }
+            }
+            assignments += localAssigned;
+            releases += localReleased;
+            rejected += localRejected;
+        });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    GateBenchmarkResult result;
+    result.assignments = assignments.load();
+    result.releases = releases.load();
+    result.rejected = rejected.load();
+    result.seconds = std::chrono::duration<double>(end - begin).count();
+    return result;
+}
+
+} // namespace Benchmark
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include "Controller/ParkingLot.hpp"
+
+namespace Benchmark {
+
+struct GateBenchmarkResult {
+    uint64_t assignments = 0;
+    uint64_t releases = 0;
+    uint64_t rejected = 0;  // lot was full for that vehicle
+    double seconds = 0.0;
+
+    double assignmentsPerSecond() const { return seconds > 0 ? assignments / seconds : 0.0; }
+};
+
+// Simulates `gates` entry/exit gates, each on its own thread, parking a mix
+// of vehicles and releasing its oldest ticket once it holds `holdPerGate`.
+// Each operation advances the gate's simulated clock by one second.
+GateBenchmarkResult runGateBenchmark(Controller::ParkingLot& lot, int gates, uint64_t operationsPerGate,
+                                     std::size_t holdPerGate, int64_t startTime = 0);
+
+} // namespace Benchmark
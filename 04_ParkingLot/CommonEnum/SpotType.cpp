@@ -0,0 +1,18 @@
+#include "SpotType.hpp"
+
+namespace CommonEnum {
+
+const char* spotTypeToString(SpotType type) {
+    switch (type) {
+        case SpotType::MOTORCYCLE:
+            return "MOTORCYCLE";
+        case SpotType::COMPACT:
+            return "COMPACT";
+        case SpotType::LARGE:
+            return "LARGE";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+} // namespace CommonEnum
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+
+namespace CommonEnum {
+
+enum class SpotType {
+    MOTORCYCLE,
+    COMPACT,
+    LARGE
+};
+
+// Number of SpotType values, used to size per-type tables
+constexpr std::size_t SPOT_TYPE_COUNT = 3;
+
+// Utility functions for SpotType enum
+const char* spotTypeToString(SpotType type);
+inline std::size_t spotTypeIndex(SpotType type) { return static_cast<std::size_t>(type); }
+
+} // namespace CommonEnum
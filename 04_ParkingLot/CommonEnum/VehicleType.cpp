@@ -0,0 +1,33 @@
+#include "VehicleType.hpp"
+
+namespace CommonEnum {
+
+const char* vehicleTypeToString(VehicleType type) {
+    switch (type) {
+        case VehicleType::MOTORCYCLE:
+            return "MOTORCYCLE";
+        case VehicleType::CAR:
+            return "CAR";
+        case VehicleType::TRUCK:
+            return "TRUCK";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+const std::vector<SpotType>& fittingSpotTypes(VehicleType type) {
+    static const std::vector<SpotType> motorcycle = {SpotType::MOTORCYCLE, SpotType::COMPACT, SpotType::LARGE};
+    static const std::vector<SpotType> car = {SpotType::COMPACT, SpotType::LARGE};
+    static const std::vector<SpotType> truck = {SpotType::LARGE};
+    switch (type) {
+        case VehicleType::MOTORCYCLE:
+            return motorcycle;
+        case VehicleType::CAR:
+            return car;
+        case VehicleType::TRUCK:
+        default:
+            return truck;
+    }
+}
+
+} // namespace CommonEnum
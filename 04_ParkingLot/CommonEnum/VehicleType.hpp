@@ -0,0 +1,20 @@
+#pragma once
+
+#include <vector>
+#include "SpotType.hpp"
+
+namespace CommonEnum {
+
+enum class VehicleType {
+    MOTORCYCLE,
+    CAR,
+    TRUCK
+};
+
+// Utility functions for VehicleType enum
+const char* vehicleTypeToString(VehicleType type);
+
+// Spot types a vehicle fits into, smallest (preferred) first
+const std::vector<SpotType>& fittingSpotTypes(VehicleType type);
+
+} // namespace CommonEnum
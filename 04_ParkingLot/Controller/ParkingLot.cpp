@@ -0,0 +1,232 @@
+#include "ParkingLot.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace Controller {
+
+ParkingLot::SpotShard::SpotShard(std::vector<uint32_t> ids)
+    : index(ids.size()), spotIds(std::move(ids)), freeCount(static_cast<uint32_t>(spotIds.size())),
+      analytics(static_cast<uint32_t>(spotIds.size())) {}
+
+ParkingLot::ParkingLot(std::vector<Utility::ParkingSpot> lotSpots, Pricing::TariffTable tariff)
+    : levelCount(0), spots(std::move(lotSpots)), tickets(spots.size()), tariff(std::move(tariff)) {
+    for (std::size_t i = 0; i < spots.size(); i++) {
+        if (spots[i].getId() != i) {
+            throw std::invalid_argument("ParkingLot: spot ids must be dense and ordered");
+        }
+        if (spots[i].getLevel() < 0) {
+            throw std::invalid_argument("ParkingLot: negative level");
+        }
+        levelCount = std::max(levelCount, spots[i].getLevel() + 1);
+    }
+
+    // Bucket spots per (level, type) and rank them by distance to the gate
+    std::vector<std::vector<uint32_t>> buckets(levelCount * CommonEnum::SPOT_TYPE_COUNT);
+    for (const auto& spot : spots) {
+        buckets[spot.getLevel() * CommonEnum::SPOT_TYPE_COUNT + CommonEnum::spotTypeIndex(spot.getType())]
+            .push_back(spot.getId());
+    }
+    for (auto& bucket : buckets) {
+        std::stable_sort(bucket.begin(), bucket.end(), [this](uint32_t a, uint32_t b) {
+            return spots[a].getDistance() < spots[b].getDistance();
+        });
+        for (uint32_t rank = 0; rank < bucket.size(); rank++) {
+            spots[bucket[rank]].setRank(rank);
+        }
+        shards.push_back(std::make_unique<SpotShard>(std::move(bucket)));
+    }
+
+    freeByLevel.reset(new PaddedCounter[levelCount]);
+    for (const auto& spot : spots) {
+        adjustFree(spot.getLevel(), spot.getType(), 1);
+    }
+}
+
+std::vector<Utility::ParkingSpot> ParkingLot::uniformLayout(int levels, uint32_t motorcycleSpots,
+                                                            uint32_t compactSpots, uint32_t largeSpots) {
+    std::vector<Utility::ParkingSpot> layout;
+    layout.reserve(static_cast<std::size_t>(levels) * (motorcycleSpots + compactSpots + largeSpots));
+    uint32_t id = 0;
+    for (int level = 0; level < levels; level++) {
+        // Motorcycle bays sit by the gate, compact rows next, large bays at the back
+        uint32_t distance = 0;
+        for (uint32_t i = 0; i < motorcycleSpots; i++) {
+            layout.emplace_back(id++, level, CommonEnum::SpotType::MOTORCYCLE, distance++);
+        }
+        for (uint32_t i = 0; i < compactSpots; i++) {
+            layout.emplace_back(id++, level, CommonEnum::SpotType::COMPACT, distance++);
+        }
+        for (uint32_t i = 0; i < largeSpots; i++) {
+            layout.emplace_back(id++, level, CommonEnum::SpotType::LARGE, distance++);
+        }
+    }
+    return layout;
+}
+
+std::optional<Utility::Ticket> ParkingLot::park(CommonEnum::VehicleType vehicleType, int gateLevel,
+                                                int64_t entryTime) {
+    gateLevel = std::clamp(gateLevel, 0, std::max(levelCount - 1, 0));
+    for (CommonEnum::SpotType type : CommonEnum::fittingSpotTypes(vehicleType)) {
+        // Visit levels outward from the gate: gate, gate+1, gate-1, gate+2, ...
+        for (int step = 0; step < 2 * levelCount; step++) {
+            int offset = (step + 1) / 2;
+            int level = (step % 2 == 1) ? gateLevel + offset : gateLevel - offset;
+            if (level < 0 || level >= levelCount) {
+                continue;
+            }
+            auto spotId = acquireFrom(shardFor(level, type), entryTime);
+            if (!spotId) {
+                continue;
+            }
+            Utility::Ticket ticket;
+            ticket.ticketId = tickets.issue(*spotId, vehicleType, entryTime);
+            ticket.spotId = *spotId;
+            ticket.vehicleType = vehicleType;
+            ticket.entryTime = entryTime;
+            fillLocation(ticket);
+            adjustFree(level, type, -1);
+            return ticket;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<Utility::Ticket> ParkingLot::unpark(uint64_t ticketId, int64_t exitTime) {
+    auto ticket = tickets.close(ticketId);
+    if (!ticket) {
+        return std::nullopt;
+    }
+    fillLocation(*ticket);
+    ticket->exitTime = exitTime;
+    ticket->feeCents = tariff.fee(ticket->spotType, exitTime - ticket->entryTime);
+
+    const Utility::ParkingSpot& spot = spots[ticket->spotId];
+    SpotShard& shard = shardFor(spot.getLevel(), spot.getType());
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.index.release(spot.getRank());
+        shard.freeCount.store(static_cast<uint32_t>(shard.index.getFreeCount()), std::memory_order_relaxed);
+        shard.analytics.onExit(exitTime, ticket->feeCents);
+    }
+    adjustFree(spot.getLevel(), spot.getType(), 1);
+    return ticket;
+}
+
+std::optional<Utility::Ticket> ParkingLot::getTicket(uint64_t ticketId) const {
+    auto ticket = tickets.lookup(ticketId);
+    if (ticket) {
+        fillLocation(*ticket);
+    }
+    return ticket;
+}
+
+uint32_t ParkingLot::getFreeSpots(int level, CommonEnum::SpotType type) const {
+    if (level < 0 || level >= levelCount) {
+        return 0;
+    }
+    return shardFor(level, type).freeCount.load(std::memory_order_relaxed);
+}
+
+uint32_t ParkingLot::getFreeSpots(CommonEnum::SpotType type) const {
+    return static_cast<uint32_t>(freeByType[CommonEnum::spotTypeIndex(type)].value.load(std::memory_order_relaxed));
+}
+
+uint32_t ParkingLot::getFreeSpotsOnLevel(int level) const {
+    if (level < 0 || level >= levelCount) {
+        return 0;
+    }
+    return static_cast<uint32_t>(freeByLevel[level].value.load(std::memory_order_relaxed));
+}
+
+uint32_t ParkingLot::getOccupiedSpots(int level, CommonEnum::SpotType type) const {
+    if (level < 0 || level >= levelCount) {
+        return 0;
+    }
+    const SpotShard& shard = shardFor(level, type);
+    return static_cast<uint32_t>(shard.spotIds.size()) - shard.freeCount.load(std::memory_order_relaxed);
+}
+
+int64_t ParkingLot::getRevenueLastHour(int level, CommonEnum::SpotType type, int64_t now) const {
+    if (level < 0 || level >= levelCount) {
+        return 0;
+    }
+    SpotShard& shard = shardFor(level, type);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.analytics.revenueInWindow(now);
+}
+
+int64_t ParkingLot::getRevenueLastHour(int64_t now) const {
+    // One O(1) window read per shard: cost depends on levels x types only
+    int64_t total = 0;
+    for (const auto& shard : shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        total += shard->analytics.revenueInWindow(now);
+    }
+    return total;
+}
+
+int64_t ParkingLot::getEntriesLastHour(int64_t now) const {
+    int64_t total = 0;
+    for (const auto& shard : shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        total += shard->analytics.entriesInWindow(now);
+    }
+    return total;
+}
+
+int64_t ParkingLot::getLifetimeRevenue() const {
+    int64_t total = 0;
+    for (const auto& shard : shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        total += shard->analytics.getLifetimeRevenue();
+    }
+    return total;
+}
+
+std::vector<Analytics::OccupancyBucket> ParkingLot::getOccupancySeries(int level, CommonEnum::SpotType type,
+                                                                       int64_t now) const {
+    if (level < 0 || level >= levelCount) {
+        return {};
+    }
+    SpotShard& shard = shardFor(level, type);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.analytics.occupancySeries(now);
+}
+
+ParkingLot::SpotShard& ParkingLot::shardFor(int level, CommonEnum::SpotType type) const {
+    return *shards[level * CommonEnum::SPOT_TYPE_COUNT + CommonEnum::spotTypeIndex(type)];
+}
+
+std::optional<uint32_t> ParkingLot::acquireFrom(SpotShard& shard, int64_t entryTime) {
+    // Cheap unlocked check lets full shards be skipped without contention
+    if (shard.freeCount.load(std::memory_order_relaxed) == 0) {
+        return std::nullopt;
+    }
+    int64_t rank;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        rank = shard.index.acquireNearest();
+        shard.freeCount.store(static_cast<uint32_t>(shard.index.getFreeCount()), std::memory_order_relaxed);
+        if (rank >= 0) {
+            shard.analytics.onEntry(entryTime);
+        }
+    }
+    if (rank < 0) {
+        return std::nullopt;
+    }
+    return shard.spotIds[rank];
+}
+
+void ParkingLot::adjustFree(int level, CommonEnum::SpotType type, int64_t delta) {
+    freeByType[CommonEnum::spotTypeIndex(type)].value.fetch_add(delta, std::memory_order_relaxed);
+    freeByLevel[level].value.fetch_add(delta, std::memory_order_relaxed);
+}
+
+void ParkingLot::fillLocation(Utility::Ticket& ticket) const {
+    const Utility::ParkingSpot& spot = spots[ticket.spotId];
+    ticket.level = spot.getLevel();
+    ticket.spotType = spot.getType();
+}
+
+} // namespace Controller
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+#include "CommonEnum/SpotType.hpp"
+#include "CommonEnum/VehicleType.hpp"
+#include "Utility/ParkingSpot.hpp"
+#include "Utility/Ticket.hpp"
+#include "SpotIndex/FreeSpotIndex.hpp"
+#include "SpotIndex/TicketTable.hpp"
+#include "Analytics/ShardAnalytics.hpp"
+#include "Analytics/OccupancySeries.hpp"
+#include "Pricing/TariffTable.hpp"
+
+namespace Controller {
+
+class ParkingLot {
+private:
+    // One shard per (level, spot type). Gates only lock the shard they
+    // allocate from, so cars, trucks and different levels never contend.
+    struct alignas(64) SpotShard {
+        std::mutex mutex;
+        SpotIndex::FreeSpotIndex index;
+        std::vector<uint32_t> spotIds;  // rank -> spot id
+        std::atomic<uint32_t> freeCount;
+        Analytics::ShardAnalytics analytics;  // guarded by mutex
+
+        explicit SpotShard(std::vector<uint32_t> ids);
+    };
+
+    // Lot-wide free counters, one cache line each
+    struct alignas(64) PaddedCounter {
+        std::atomic<int64_t> value{0};
+    };
+
+    int levelCount;
+    std::vector<Utility::ParkingSpot> spots;
+    std::vector<std::unique_ptr<SpotShard>> shards;
+    SpotIndex::TicketTable tickets;
+    Pricing::TariffTable tariff;
+    std::array<PaddedCounter, CommonEnum::SPOT_TYPE_COUNT> freeByType;
+    std::unique_ptr<PaddedCounter[]> freeByLevel;
+
+public:
+    // Spot ids must be 0..n-1 in order; ranks are assigned from distances
+    explicit ParkingLot(std::vector<Utility::ParkingSpot> spots,
+                        Pricing::TariffTable tariff = Pricing::TariffTable::standard());
+
+    // Convenience layout: every level gets the same number of spots per type
+    static std::vector<Utility::ParkingSpot> uniformLayout(int levels, uint32_t motorcycleSpots,
+                                                           uint32_t compactSpots, uint32_t largeSpots);
+
+    // Assign the nearest free spot that fits, searching the gate's level first
+    std::optional<Utility::Ticket> park(CommonEnum::VehicleType vehicleType, int gateLevel, int64_t entryTime);
+
+    // Free the spot behind a ticket and price the stay; returns nullopt for
+    // unknown or already-used tickets
+    std::optional<Utility::Ticket> unpark(uint64_t ticketId, int64_t exitTime);
+
+    std::optional<Utility::Ticket> getTicket(uint64_t ticketId) const;
+
+    // Getters
+    int getLevelCount() const { return levelCount; }
+    std::size_t getSpotCount() const { return spots.size(); }
+    const Utility::ParkingSpot& getSpot(uint32_t spotId) const { return spots[spotId]; }
+
+    // Dashboard queries; none of them scans spots or tickets
+    uint32_t getFreeSpots(int level, CommonEnum::SpotType type) const;
+    uint32_t getFreeSpots(CommonEnum::SpotType type) const;
+    uint32_t getFreeSpotsOnLevel(int level) const;
+    uint32_t getOccupiedSpots(int level, CommonEnum::SpotType type) const;
+    int64_t getRevenueLastHour(int level, CommonEnum::SpotType type, int64_t now) const;
+    int64_t getRevenueLastHour(int64_t now) const;
+    int64_t getEntriesLastHour(int64_t now) const;
+    int64_t getLifetimeRevenue() const;
+    std::vector<Analytics::OccupancyBucket> getOccupancySeries(int level, CommonEnum::SpotType type,
+                                                               int64_t now) const;
+
+private:
+    SpotShard& shardFor(int level, CommonEnum::SpotType type) const;
+    std::optional<uint32_t> acquireFrom(SpotShard& shard, int64_t entryTime);
+    void adjustFree(int level, CommonEnum::SpotType type, int64_t delta);
+    void fillLocation(Utility::Ticket& ticket) const;
+};
+
+} // namespace Controller
@@ -0,0 +1,59 @@
+#include "TariffTable.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Pricing {
+
+namespace {
+constexpr int64_t SECONDS_PER_HOUR = 3600;
+constexpr int64_t SECONDS_PER_DAY = 24 * SECONDS_PER_HOUR;
+}
+
+TariffTable::TariffTable(const std::array<TariffRule, CommonEnum::SPOT_TYPE_COUNT>& rules,
+                         int64_t bucketSeconds, int64_t graceSeconds)
+    : bucketSeconds(bucketSeconds), graceSeconds(graceSeconds), rules(rules) {
+    // Rounding a stay up to its bucket must never cross an hour boundary
+    if (bucketSeconds <= 0 || SECONDS_PER_HOUR % bucketSeconds != 0) {
+        throw std::invalid_argument("TariffTable: bucket width must divide an hour");
+    }
+    std::size_t buckets = static_cast<std::size_t>(SECONDS_PER_DAY / bucketSeconds);
+    for (std::size_t type = 0; type < CommonEnum::SPOT_TYPE_COUNT; type++) {
+        const TariffRule& rule = rules[type];
+        fees[type].resize(buckets + 1);
+        for (std::size_t bucket = 0; bucket <= buckets; bucket++) {
+            // Bucket k prices stays of up to k * bucketSeconds; the grace
+            // period is checked against the real duration in fee()
+            int64_t duration = static_cast<int64_t>(bucket) * bucketSeconds;
+            int64_t fee = 0;
+            if (duration > 0) {
+                int64_t hours = (duration + SECONDS_PER_HOUR - 1) / SECONDS_PER_HOUR;
+                fee = rule.firstHourCents + (hours - 1) * rule.extraHourCents;
+            }
+            fees[type][bucket] = std::min(fee, rule.dailyMaxCents);
+        }
+    }
+}
+
+TariffTable TariffTable::standard() {
+    return TariffTable({{
+        {200, 100, 1200},   // MOTORCYCLE
+        {400, 300, 3000},   // COMPACT
+        {600, 450, 4500},   // LARGE
+    }});
+}
+
+int64_t TariffTable::fee(CommonEnum::SpotType type, int64_t durationSeconds) const {
+    if (durationSeconds <= 0) {
+        return 0;
+    }
+    std::size_t index = CommonEnum::spotTypeIndex(type);
+    int64_t days = durationSeconds / SECONDS_PER_DAY;
+    int64_t rest = durationSeconds % SECONDS_PER_DAY;
+    if (days == 0 && rest <= graceSeconds) {
+        return 0;
+    }
+    std::size_t bucket = static_cast<std::size_t>((rest + bucketSeconds - 1) / bucketSeconds);
+    return days * rules[index].dailyMaxCents + fees[index][bucket];
+}
+
+} // namespace Pricing
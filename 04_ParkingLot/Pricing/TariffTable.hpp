@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "CommonEnum/SpotType.hpp"
+
+namespace Pricing {
+
+struct TariffRule {
+    int64_t firstHourCents;
+    int64_t extraHourCents;  // each started hour after the first
+    int64_t dailyMaxCents;
+};
+
+// Fees precomputed for every duration bucket of a day, per spot type, so
+// pricing an exit is a division and a table lookup. Stays longer than a
+// day pay the daily maximum per full day plus the table fee for the rest.
+// Stays no longer than the grace period are free.
+class TariffTable {
+private:
+    int64_t bucketSeconds;
+    int64_t graceSeconds;
+    std::array<TariffRule, CommonEnum::SPOT_TYPE_COUNT> rules;
+    std::array<std::vector<int64_t>, CommonEnum::SPOT_TYPE_COUNT> fees;
+
+public:
+    TariffTable(const std::array<TariffRule, CommonEnum::SPOT_TYPE_COUNT>& rules,
+                int64_t bucketSeconds = 15 * 60, int64_t graceSeconds = 10 * 60);
+
+    // Default city-centre tariff
+    static TariffTable standard();
+
+    int64_t fee(CommonEnum::SpotType type, int64_t durationSeconds) const;
+
+    // Getters
+    int64_t getBucketSeconds() const { return bucketSeconds; }
+    int64_t getGraceSeconds() const { return graceSeconds; }
+    const TariffRule& getRule(CommonEnum::SpotType type) const { return rules[CommonEnum::spotTypeIndex(type)]; }
+};
+
+} // namespace Pricing
@@ -0,0 +1,84 @@
+#include "FreeSpotIndex.hpp"
+#include <stdexcept>
+
+namespace SpotIndex {
+
+FreeSpotIndex::FreeSpotIndex(std::size_t capacity, bool allFree) : capacity(capacity), freeCount(0) {
+    std::size_t bits = capacity == 0 ? 1 : capacity;
+    do {
+        std::size_t words = (bits + 63) / 64;
+        levels.emplace_back(words, 0);
+        bits = words;
+    } while (bits > 1);
+
+    if (allFree) {
+        for (std::size_t rank = 0; rank < capacity; rank++) {
+            setBit(rank);
+        }
+        freeCount = capacity;
+    }
+}
+
+int64_t FreeSpotIndex::acquireNearest() {
+    if (levels.back()[0] == 0) {
+        return -1;
+    }
+    std::size_t index = 0;
+    for (std::size_t level = levels.size(); level-- > 0;) {
+        index = index * 64 + static_cast<std::size_t>(__builtin_ctzll(levels[level][index]));
+    }
+    clearBit(index);
+    freeCount--;
+    return static_cast<int64_t>(index);
+}
+
+bool FreeSpotIndex::acquire(std::size_t rank) {
+    if (!isFree(rank)) {
+        return false;
+    }
+    clearBit(rank);
+    freeCount--;
+    return true;
+}
+
+void FreeSpotIndex::release(std::size_t rank) {
+    if (rank >= capacity) {
+        throw std::out_of_range("FreeSpotIndex::release: rank out of range");
+    }
+    if (isFree(rank)) {
+        return;
+    }
+    setBit(rank);
+    freeCount++;
+}
+
+bool FreeSpotIndex::isFree(std::size_t rank) const {
+    return rank < capacity && (levels[0][rank / 64] >> (rank % 64)) & 1ULL;
+}
+
+void FreeSpotIndex::setBit(std::size_t rank) {
+    std::size_t index = rank;
+    for (auto& words : levels) {
+        uint64_t& word = words[index / 64];
+        bool wasEmpty = word == 0;
+        word |= 1ULL << (index % 64);
+        if (!wasEmpty) {
+            break;
+        }
+        index /= 64;
+    }
+}
+
+void FreeSpotIndex::clearBit(std::size_t rank) {
+    std::size_t index = rank;
+    for (auto& words : levels) {
+        uint64_t& word = words[index / 64];
+        word &= ~(1ULL << (index % 64));
+        if (word != 0) {
+            break;
+        }
+        index /= 64;
+    }
+}
+
+} // namespace SpotIndex
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SpotIndex {
+
+// Hierarchical bitmap over the spots of one (level, type) bucket.
+// Bit i is set when the spot with rank i is free; ranks are assigned in
+// order of distance to the gate, so the lowest set bit is the nearest
+// free spot. Each summary level has one bit per non-empty word of the
+// level below, giving O(log64 n) acquire/release with find-first-set.
+class FreeSpotIndex {
+private:
+    std::vector<std::vector<uint64_t>> levels;  // levels[0] holds one bit per spot
+    std::size_t capacity;
+    std::size_t freeCount;
+
+public:
+    explicit FreeSpotIndex(std::size_t capacity, bool allFree = true);
+
+    // Claim the nearest free spot; returns -1 when the bucket is full
+    int64_t acquireNearest();
+    // Claim a specific spot; returns false if it was not free
+    bool acquire(std::size_t rank);
+    void release(std::size_t rank);
+
+    bool isFree(std::size_t rank) const;
+    std::size_t getFreeCount() const { return freeCount; }
+    std::size_t getCapacity() const { return capacity; }
+
+private:
+    void setBit(std::size_t rank);
+    void clearBit(std::size_t rank);
+};
+
+} // namespace SpotIndex
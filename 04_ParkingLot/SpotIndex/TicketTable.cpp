@@ -0,0 +1,57 @@
+#include "TicketTable.hpp"
+
+namespace SpotIndex {
+
+TicketTable::TicketTable(std::size_t spotCount) : slots(spotCount) {}
+
+uint64_t TicketTable::issue(uint32_t spotId, CommonEnum::VehicleType vehicleType, int64_t entryTime) {
+    Slot& slot = slots[spotId];
+    if (++slot.generation == 0) {
+        slot.generation = 1;  // keep 0 reserved for "no ticket"
+    }
+    uint64_t ticketId = Utility::Ticket::makeId(slot.generation, spotId);
+    slot.entryTime.store(entryTime, std::memory_order_relaxed);
+    slot.vehicleType.store(static_cast<uint8_t>(vehicleType), std::memory_order_relaxed);
+    slot.activeTicket.store(ticketId, std::memory_order_release);
+    return ticketId;
+}
+
+std::optional<Utility::Ticket> TicketTable::lookup(uint64_t ticketId) const {
+    auto ticket = read(ticketId);
+    // Re-check so we never return fields of a ticket that was closed meanwhile
+    if (ticket && slots[ticket->spotId].activeTicket.load(std::memory_order_acquire) != ticketId) {
+        return std::nullopt;
+    }
+    return ticket;
+}
+
+std::optional<Utility::Ticket> TicketTable::close(uint64_t ticketId) {
+    auto ticket = read(ticketId);
+    if (!ticket) {
+        return std::nullopt;
+    }
+    uint64_t expected = ticketId;
+    if (!slots[ticket->spotId].activeTicket.compare_exchange_strong(expected, 0, std::memory_order_acq_rel)) {
+        return std::nullopt;
+    }
+    return ticket;
+}
+
+std::optional<Utility::Ticket> TicketTable::read(uint64_t ticketId) const {
+    uint32_t spotId = Utility::Ticket::spotIdOf(ticketId);
+    if (ticketId == 0 || spotId >= slots.size()) {
+        return std::nullopt;
+    }
+    const Slot& slot = slots[spotId];
+    if (slot.activeTicket.load(std::memory_order_acquire) != ticketId) {
+        return std::nullopt;
+    }
+    Utility::Ticket ticket;
+    ticket.ticketId = ticketId;
+    ticket.spotId = spotId;
+    ticket.entryTime = slot.entryTime.load(std::memory_order_relaxed);
+    ticket.vehicleType = static_cast<CommonEnum::VehicleType>(slot.vehicleType.load(std::memory_order_relaxed));
+    return ticket;
+}
+
+} // namespace SpotIndex
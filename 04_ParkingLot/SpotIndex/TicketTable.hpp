@@ -0,0 +1,42 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include "Utility/Ticket.hpp"
+
+namespace SpotIndex {
+
+// Flat ticket store with one slot per spot. Because a ticket id embeds
+// its spot id, lookup is a single array access plus a generation check,
+// and entry/exit gates never share a lock here: only the gate that won
+// the spot writes the slot, and exits race on a single CAS.
+class TicketTable {
+private:
+    struct Slot {
+        std::atomic<uint64_t> activeTicket{0};  // 0 when the spot is empty
+        std::atomic<int64_t> entryTime{0};
+        std::atomic<uint8_t> vehicleType{0};
+        uint32_t generation = 0;  // only touched by the gate owning the spot
+    };
+
+    std::vector<Slot> slots;
+
+public:
+    explicit TicketTable(std::size_t spotCount);
+
+    // Record a new ticket for a spot the caller has exclusively acquired
+    uint64_t issue(uint32_t spotId, CommonEnum::VehicleType vehicleType, int64_t entryTime);
+
+    // Fills everything but the spot location; returns nullopt for stale or unknown ids
+    std::optional<Utility::Ticket> lookup(uint64_t ticketId) const;
+
+    // Close a ticket exactly once; concurrent closes of the same id see one winner
+    std::optional<Utility::Ticket> close(uint64_t ticketId);
+
+private:
+    std::optional<Utility::Ticket> read(uint64_t ticketId) const;
+};
+
+} // namespace SpotIndex
@@ -0,0 +1,8 @@
+#include "ParkingSpot.hpp"
+
+namespace Utility {
+
+ParkingSpot::ParkingSpot(uint32_t id, int level, CommonEnum::SpotType type, uint32_t distance)
+    : id(id), level(level), type(type), distance(distance), rank(0) {}
+
+} // namespace Utility
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include "CommonEnum/SpotType.hpp"
+
+namespace Utility {
+
+class ParkingSpot {
+private:
+    uint32_t id;
+    int level;
+    CommonEnum::SpotType type;
+    uint32_t distance;  // walking distance to the entry gate of its level
+    uint32_t rank;      // position within its (level, type) free-spot index
+
+public:
+    ParkingSpot(uint32_t id, int level, CommonEnum::SpotType type, uint32_t distance);
+
+    // Getters
+    uint32_t getId() const { return id; }
+    int getLevel() const { return level; }
+    CommonEnum::SpotType getType() const { return type; }
+    uint32_t getDistance() const { return distance; }
+    uint32_t getRank() const { return rank; }
+
+    void setRank(uint32_t value) { rank = value; }
+};
+
+} // namespace Utility
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include "CommonEnum/SpotType.hpp"
+#include "CommonEnum/VehicleType.hpp"
+
+namespace Utility {
+
+// Ticket ids carry the spot id in the low 32 bits and the spot's
+// occupancy generation in the high 32 bits, so a lookup needs no map.
+struct Ticket {
+    uint64_t ticketId = 0;
+    uint32_t spotId = 0;
+    int level = 0;
+    CommonEnum::SpotType spotType = CommonEnum::SpotType::COMPACT;
+    CommonEnum::VehicleType vehicleType = CommonEnum::VehicleType::CAR;
+    int64_t entryTime = 0;  // seconds since epoch
+    int64_t exitTime = 0;   // set once the ticket is closed
+    int64_t feeCents = 0;
+
+    static uint32_t spotIdOf(uint64_t ticketId) { return static_cast<uint32_t>(ticketId); }
+    static uint64_t makeId(uint32_t generation, uint32_t spotId) {
+        return (static_cast<uint64_t>(generation) << 32) | spotId;
+    }
+};
+
+} // namespace Utility
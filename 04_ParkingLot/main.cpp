@@ -1,2 +1,69 @@
+#include "Controller/ParkingLot.hpp"
+#include "Benchmark/GateBenchmark.hpp"
+#include <algorithm>
+#include <iomanip>
 #include <iostream>
-int main() { std::cout << "Parking Lot Implementation" << std::endl; return 0; }
+#include <thread>
+
+int main() {
+    std::cout << "Parking Lot Implementation" << std::endl;
+
+    // 5 levels x 10k spots
+    Controller::ParkingLot lot(Controller::ParkingLot::uniformLayout(5, 2000, 6000, 2000));
+    std::cout << "Spots: " << lot.getSpotCount() << " across " << lot.getLevelCount() << " levels" << std::endl;
+
+    // Walk through a single entry/exit
+    const int64_t opening = 1700000000;
+    auto ticket = lot.park(CommonEnum::VehicleType::CAR, 2, opening);
+    if (ticket) {
+        std::cout << "Issued ticket " << ticket->ticketId << " -> level " << ticket->level << " "
+                  << CommonEnum::spotTypeToString(ticket->spotType) << " spot " << ticket->spotId << std::endl;
+        auto closed = lot.unpark(ticket->ticketId, opening + 95 * 60);
+        std::cout << "Exit after 95 minutes, fee " << closed->feeCents << " cents" << std::endl;
+        std::cout << "Ticket reused after exit? " << (lot.getTicket(ticket->ticketId) ? "yes" : "no") << std::endl;
+    }
+
+    // Tariff boundaries checked against a direct per-started-hour computation
+    Pricing::TariffTable tariff = Pricing::TariffTable::standard();
+    const Pricing::TariffRule& rule = tariff.getRule(CommonEnum::SpotType::COMPACT);
+    int64_t grace = tariff.getGraceSeconds();
+    int64_t bucket = tariff.getBucketSeconds();
+    bool tariffConsistent = true;
+    std::cout << "Compact fees:";
+    for (int64_t duration : {int64_t(1), grace - 1, grace, grace + 1, bucket - 1, bucket, bucket + 1,
+                             int64_t(3600), int64_t(3601), int64_t(86400), int64_t(86400 + 1)}) {
+        int64_t days = duration / 86400;
+        int64_t rest = duration % 86400;
+        int64_t hours = (rest + 3599) / 3600;
+        int64_t expected = days * rule.dailyMaxCents;
+        if (!(days == 0 && rest <= grace) && hours > 0) {
+            expected += std::min(rule.firstHourCents + (hours - 1) * rule.extraHourCents, rule.dailyMaxCents);
+        }
+        int64_t fee = tariff.fee(CommonEnum::SpotType::COMPACT, duration);
+        tariffConsistent = tariffConsistent && fee == expected;
+        std::cout << " " << duration << "s=" << fee;
+    }
+    std::cout << (tariffConsistent ? " (consistent)" : " (MISMATCH)") << std::endl;
+
+    int gates = static_cast<int>(std::max(4u, std::thread::hardware_concurrency()));
+    const uint64_t operationsPerGate = 500000;
+    auto result = Benchmark::runGateBenchmark(lot, gates, operationsPerGate, 8000, opening);
+    std::cout << "Gates: " << gates << ", assignments: " << result.assignments
+              << ", releases: " << result.releases << ", rejected: " << result.rejected << std::endl;
+    std::cout << "Assignments/sec: " << static_cast<uint64_t>(result.assignmentsPerSecond()) << std::endl;
+
+    // Dashboard at the end of the simulated run
+    std::cout << std::fixed << std::setprecision(2);
+    int64_t now = opening + static_cast<int64_t>(operationsPerGate);
+    std::cout << "Free compact spots on level 3: " << lot.getFreeSpots(3, CommonEnum::SpotType::COMPACT) << std::endl;
+    std::cout << "Free large spots lot-wide: " << lot.getFreeSpots(CommonEnum::SpotType::LARGE) << std::endl;
+    std::cout << "Revenue last hour: " << lot.getRevenueLastHour(now) / 100.0 << " (lifetime "
+              << lot.getLifetimeRevenue() / 100.0 << ")" << std::endl;
+    auto series = lot.getOccupancySeries(0, CommonEnum::SpotType::COMPACT, now - 1);
+    std::cout << "Level 0 compact peak occupancy, last 5 minutes:";
+    for (std::size_t i = series.size() >= 5 ? series.size() - 5 : 0; i < series.size(); i++) {
+        std::cout << " " << series[i].peakOccupied;
+    }
+    std::cout << std::endl;
+    return 0;
+}
@@ -0,0 +1,18 @@
+#include "Direction.hpp"
+
+namespace CommonEnum {
+
+const char* directionToString(Direction direction) {
+    switch (direction) {
+        case Direction::UP:
+            return "UP";
+        case Direction::DOWN:
+            return "DOWN";
+        case Direction::IDLE:
+            return "IDLE";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+} // namespace CommonEnum
@@ -0,0 +1,17 @@
+#pragma once
+
+namespace CommonEnum {
+
+enum class Direction {
+    UP,
+    DOWN,
+    IDLE
+};
+
+// Utility functions for Direction enum
+const char* directionToString(Direction direction);
+inline int directionStep(Direction direction) {
+    return direction == Direction::UP ? 1 : direction == Direction::DOWN ? -1 : 0;
+}
+
+} // namespace CommonEnum
@@ -0,0 +1,33 @@
+#include "GroupDispatcher.hpp"
+#include <stdexcept>
+
+namespace Controller {
+
+GroupDispatcher::GroupDispatcher(int floors, int carCount, int carCapacity,
+                                 std::shared_ptr<Scheduling::SchedulingStrategy> strategy)
+    : strategy(std::move(strategy)), decisions(0) {
+    if (floors < 2 || carCount < 1 || carCapacity < 1) {
+        throw std::invalid_argument("GroupDispatcher: need at least 2 floors, 1 car and capacity 1");
+    }
+    if (!this->strategy) {
+        throw std::invalid_argument("GroupDispatcher: strategy is required");
+    }
+    cars.reserve(carCount);
+    for (int i = 0; i < carCount; i++) {
+        cars.emplace_back(i, floors, carCapacity);
+    }
+}
+
+std::size_t GroupDispatcher::dispatch(const Utility::PassengerRequest& request) {
+    decisions++;
+    std::size_t index = strategy->selectCar(request, cars);
+    cars[index].assignPickup(request);
+    return index;
+}
+
+CommonEnum::Direction GroupDispatcher::nextDirection(std::size_t carIndex) {
+    decisions++;
+    return strategy->nextDirection(cars[carIndex]);
+}
+
+} // namespace Controller
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Utility/ElevatorCar.hpp"
+#include "Utility/PassengerRequest.hpp"
+#include "Scheduling/SchedulingStrategy.hpp"
+
+namespace Controller {
+
+// Owns the cars of one elevator bank and delegates every scheduling
+// decision to the pluggable strategy.
+class GroupDispatcher {
+private:
+    std::vector<Utility::ElevatorCar> cars;
+    std::shared_ptr<Scheduling::SchedulingStrategy> strategy;
+    uint64_t decisions;
+
+public:
+    GroupDispatcher(int floors, int carCount, int carCapacity,
+                    std::shared_ptr<Scheduling::SchedulingStrategy> strategy);
+
+    // Assign a hall call to a car and queue it there; returns the car index
+    std::size_t dispatch(const Utility::PassengerRequest& request);
+    CommonEnum::Direction nextDirection(std::size_t carIndex);
+
+    // Getters
+    Utility::ElevatorCar& getCar(std::size_t index) { return cars[index]; }
+    std::size_t getCarCount() const { return cars.size(); }
+    uint64_t getDecisions() const { return decisions; }
+    const Scheduling::SchedulingStrategy& getStrategy() const { return *strategy; }
+};
+
+} // namespace Controller
@@ -0,0 +1,40 @@
+#include "DestinationDispatchStrategy.hpp"
+#include "Utility/ElevatorCar.hpp"
+#include "Utility/PassengerRequest.hpp"
+#include <cstdlib>
+#include <limits>
+
+namespace Scheduling {
+namespace ConcreteStrategies {
+
+DestinationDispatchStrategy::DestinationDispatchStrategy(int stopPenalty, int loadPenalty)
+    : stopPenalty(stopPenalty), loadPenalty(loadPenalty) {}
+
+std::size_t DestinationDispatchStrategy::selectCar(const Utility::PassengerRequest& request,
+                                                   const std::vector<Utility::ElevatorCar>& cars) const {
+    std::size_t best = 0;
+    long bestCost = std::numeric_limits<long>::max();
+    for (std::size_t i = 0; i < cars.size(); i++) {
+        const auto& car = cars[i];
+        int newStops = (car.hasStopAt(request.origin) ? 0 : 1) + (car.hasStopAt(request.destination) ? 0 : 1);
+        long cost = sweepDistance(car, request.origin, request.getDirection(), false)
+                  + std::abs(request.destination - request.origin)
+                  + static_cast<long>(stopPenalty) * newStops
+                  + static_cast<long>(loadPenalty) * (car.getPendingPickups() + car.getLoad());
+        if (car.getPendingPickups() + car.getLoad() >= car.getCapacity()) {
+            cost += static_cast<long>(stopPenalty) * car.getCapacity();  // likely to pass the caller by
+        }
+        if (cost < bestCost) {
+            bestCost = cost;
+            best = i;
+        }
+    }
+    return best;
+}
+
+CommonEnum::Direction DestinationDispatchStrategy::nextDirection(const Utility::ElevatorCar& car) const {
+    return lookDirection(car);
+}
+
+} // namespace ConcreteStrategies
+} // namespace Scheduling
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Scheduling/SchedulingStrategy.hpp"
+
+namespace Scheduling {
+namespace ConcreteStrategies {
+
+// Destination dispatch: passengers enter their destination at the hall
+// kiosk, so a call is costed by the time to reach the origin plus the new
+// stops it adds. Calls sharing a car's existing stops are grouped together.
+class DestinationDispatchStrategy : public SchedulingStrategy {
+private:
+    int stopPenalty;
+    int loadPenalty;
+
+public:
+    explicit DestinationDispatchStrategy(int stopPenalty = 6, int loadPenalty = 1);
+
+    const char* getName() const override { return "DESTINATION"; }
+    std::size_t selectCar(const Utility::PassengerRequest& request,
+                          const std::vector<Utility::ElevatorCar>& cars) const override;
+    CommonEnum::Direction nextDirection(const Utility::ElevatorCar& car) const override;
+};
+
+} // namespace ConcreteStrategies
+} // namespace Scheduling
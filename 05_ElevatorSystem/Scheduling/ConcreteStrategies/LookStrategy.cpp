@@ -0,0 +1,31 @@
+#include "LookStrategy.hpp"
+#include "Utility/ElevatorCar.hpp"
+#include <limits>
+
+namespace Scheduling {
+namespace ConcreteStrategies {
+
+LookStrategy::LookStrategy(int stopPenalty) : stopPenalty(stopPenalty) {}
+
+std::size_t LookStrategy::selectCar(const Utility::PassengerRequest& request,
+                                    const std::vector<Utility::ElevatorCar>& cars) const {
+    std::size_t best = 0;
+    long bestCost = std::numeric_limits<long>::max();
+    for (std::size_t i = 0; i < cars.size(); i++) {
+        const auto& car = cars[i];
+        long cost = sweepDistance(car, request.origin, request.getDirection(), false)
+                  + static_cast<long>(stopPenalty) * (car.getPendingPickups() + car.getLoad());
+        if (cost < bestCost) {
+            bestCost = cost;
+            best = i;
+        }
+    }
+    return best;
+}
+
+CommonEnum::Direction LookStrategy::nextDirection(const Utility::ElevatorCar& car) const {
+    return lookDirection(car);
+}
+
+} // namespace ConcreteStrategies
+} // namespace Scheduling
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Scheduling/SchedulingStrategy.hpp"
+
+namespace Scheduling {
+namespace ConcreteStrategies {
+
+// Nearest-car dispatching with LOOK movement: a call goes to the car with
+// the shortest sweep distance plus a penalty per pending stop.
+class LookStrategy : public SchedulingStrategy {
+private:
+    int stopPenalty;  // floors-equivalent cost of each extra door cycle
+
+public:
+    explicit LookStrategy(int stopPenalty = 3);
+
+    const char* getName() const override { return "LOOK"; }
+    std::size_t selectCar(const Utility::PassengerRequest& request,
+                          const std::vector<Utility::ElevatorCar>& cars) const override;
+    CommonEnum::Direction nextDirection(const Utility::ElevatorCar& car) const override;
+};
+
+} // namespace ConcreteStrategies
+} // namespace Scheduling
@@ -0,0 +1,47 @@
+#include "ScanStrategy.hpp"
+#include "Utility/ElevatorCar.hpp"
+#include <limits>
+
+namespace Scheduling {
+namespace ConcreteStrategies {
+
+using CommonEnum::Direction;
+
+ScanStrategy::ScanStrategy(int stopPenalty) : stopPenalty(stopPenalty) {}
+
+std::size_t ScanStrategy::selectCar(const Utility::PassengerRequest& request,
+                                    const std::vector<Utility::ElevatorCar>& cars) const {
+    std::size_t best = 0;
+    long bestCost = std::numeric_limits<long>::max();
+    for (std::size_t i = 0; i < cars.size(); i++) {
+        const auto& car = cars[i];
+        long cost = sweepDistance(car, request.origin, request.getDirection(), true)
+                  + static_cast<long>(stopPenalty) * (car.getPendingPickups() + car.getLoad());
+        if (cost < bestCost) {
+            bestCost = cost;
+            best = i;
+        }
+    }
+    return best;
+}
+
+Direction ScanStrategy::nextDirection(const Utility::ElevatorCar& car) const {
+    if (!car.hasWork()) {
+        return Direction::IDLE;
+    }
+    int at = car.getFloor();
+    int top = car.getFloorCount() - 1;
+    switch (car.getDirection()) {
+        case Direction::UP:
+            return at < top ? Direction::UP : Direction::DOWN;
+        case Direction::DOWN:
+            return at > 0 ? Direction::DOWN : Direction::UP;
+        case Direction::IDLE:
+        default:
+            // Starting from rest behaves like LOOK until a sweep is under way
+            return lookDirection(car);
+    }
+}
+
+} // namespace ConcreteStrategies
+} // namespace Scheduling
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Scheduling/SchedulingStrategy.hpp"
+
+namespace Scheduling {
+namespace ConcreteStrategies {
+
+// Classic elevator algorithm: while any work is pending a car sweeps all
+// the way to the top or bottom floor before reversing.
+class ScanStrategy : public SchedulingStrategy {
+private:
+    int stopPenalty;
+
+public:
+    explicit ScanStrategy(int stopPenalty = 3);
+
+    const char* getName() const override { return "SCAN"; }
+    std::size_t selectCar(const Utility::PassengerRequest& request,
+                          const std::vector<Utility::ElevatorCar>& cars) const override;
+    CommonEnum::Direction nextDirection(const Utility::ElevatorCar& car) const override;
+};
+
+} // namespace ConcreteStrategies
+} // namespace Scheduling
@@ -0,0 +1,68 @@
+#include "SchedulingStrategy.hpp"
+#include "Utility/ElevatorCar.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+namespace Scheduling {
+
+using CommonEnum::Direction;
+
+int SchedulingStrategy::sweepDistance(const Utility::ElevatorCar& car, int target,
+                                      Direction targetDirection, bool toTerminal) {
+    int at = car.getFloor();
+    Direction heading = car.getDirection();
+    if (heading == Direction::IDLE || !car.hasWork()) {
+        return std::abs(at - target);
+    }
+
+    int top = car.getFloorCount() - 1;
+    int highest = toTerminal ? top : std::max({car.highestStop(), at, target});
+    int lowest = toTerminal ? 0 : std::min({car.lowestStop() < 0 ? at : car.lowestStop(), at, target});
+
+    if (heading == Direction::UP) {
+        if (targetDirection == Direction::UP && target >= at) {
+            return target - at;
+        }
+        if (targetDirection == Direction::DOWN) {
+            return (highest - at) + (highest - target);
+        }
+        // Up call behind the car: finish the up sweep, come down, go back up
+        return (highest - at) + (highest - lowest) + (target - lowest);
+    }
+
+    if (targetDirection == Direction::DOWN && target <= at) {
+        return at - target;
+    }
+    if (targetDirection == Direction::UP) {
+        return (at - lowest) + (target - lowest);
+    }
+    return (at - lowest) + (highest - lowest) + (highest - target);
+}
+
+Direction SchedulingStrategy::lookDirection(const Utility::ElevatorCar& car) {
+    int at = car.getFloor();
+    bool above = car.hasWorkAbove(at);
+    bool below = car.hasWorkBelow(at);
+    switch (car.getDirection()) {
+        case Direction::UP:
+            if (above) return Direction::UP;
+            if (below) return Direction::DOWN;
+            break;
+        case Direction::DOWN:
+            if (below) return Direction::DOWN;
+            if (above) return Direction::UP;
+            break;
+        case Direction::IDLE:
+        default:
+            if (above && below) {
+                // Head towards the closer end of the pending work
+                return car.highestStop() - at <= at - car.lowestStop() ? Direction::UP : Direction::DOWN;
+            }
+            if (above) return Direction::UP;
+            if (below) return Direction::DOWN;
+            break;
+    }
+    return car.waitingDirection();
+}
+
+} // namespace Scheduling
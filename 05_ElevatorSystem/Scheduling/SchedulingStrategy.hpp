@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "CommonEnum/Direction.hpp"
+
+// Forward declarations
+namespace Utility {
+    class ElevatorCar;
+    struct PassengerRequest;
+}
+
+namespace Scheduling {
+
+// Strategy for the group dispatcher: which car serves a new hall call,
+// and where a car heads next after servicing a floor.
+class SchedulingStrategy {
+public:
+    virtual ~SchedulingStrategy() = default;
+
+    virtual const char* getName() const = 0;
+    virtual std::size_t selectCar(const Utility::PassengerRequest& request,
+                                  const std::vector<Utility::ElevatorCar>& cars) const = 0;
+    virtual CommonEnum::Direction nextDirection(const Utility::ElevatorCar& car) const = 0;
+
+protected:
+    // Floors a car must travel before it reaches `target` heading `targetDirection`,
+    // following its current sweep. `toTerminal` models SCAN, which only reverses
+    // at the top or bottom floor, instead of LOOK, which reverses at the last stop.
+    static int sweepDistance(const Utility::ElevatorCar& car, int target,
+                             CommonEnum::Direction targetDirection, bool toTerminal);
+    // LOOK: keep going while stops remain ahead, otherwise reverse or idle
+    static CommonEnum::Direction lookDirection(const Utility::ElevatorCar& car);
+};
+
+} // namespace Scheduling
@@ -0,0 +1,26 @@
+#include "SimulationStats.hpp"
+#include <algorithm>
+
+namespace Simulation {
+
+void SimulationStats::recordWait(double wait) {
+    boarded++;
+    totalWait += wait;
+    maxWait = std::max(maxWait, wait);
+    std::size_t bucket = std::min(static_cast<std::size_t>(wait), WAIT_BUCKETS - 1);
+    waitHistogram[bucket]++;
+}
+
+double SimulationStats::waitPercentile(double percentile) const {
+    uint64_t target = static_cast<uint64_t>(percentile / 100.0 * boarded);
+    uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < waitHistogram.size(); bucket++) {
+        seen += waitHistogram[bucket];
+        if (seen > target) {
+            return static_cast<double>(bucket + 1);
+        }
+    }
+    return static_cast<double>(WAIT_BUCKETS);
+}
+
+} // namespace Simulation
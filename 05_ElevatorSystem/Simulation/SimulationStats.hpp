@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Simulation {
+
+struct SimulationStats {
+    uint64_t requests = 0;
+    uint64_t boarded = 0;
+    uint64_t delivered = 0;
+    uint64_t decisions = 0;
+    uint64_t events = 0;
+    double totalWait = 0.0;   // arrival -> boarding
+    double totalTrip = 0.0;   // arrival -> destination
+    double maxWait = 0.0;
+    double simulatedSeconds = 0.0;
+    double wallSeconds = 0.0;
+    std::vector<uint64_t> waitHistogram = std::vector<uint64_t>(WAIT_BUCKETS, 0);  // 1s buckets
+
+    static constexpr std::size_t WAIT_BUCKETS = 600;
+
+    void recordWait(double wait);
+    void recordTrip(double trip) { delivered++; totalTrip += trip; }
+
+    double averageWait() const { return boarded ? totalWait / boarded : 0.0; }
+    double averageTrip() const { return delivered ? totalTrip / delivered : 0.0; }
+    double waitPercentile(double percentile) const;
+    double decisionsPerSecond() const { return wallSeconds > 0 ? decisions / wallSeconds : 0.0; }
+    double speedup() const { return wallSeconds > 0 ? simulatedSeconds / wallSeconds : 0.0; }
+};
+
+} // namespace Simulation
@@ -0,0 +1,92 @@
+#include "Simulator.hpp"
+#include <chrono>
+
+namespace Simulation {
+
+using CommonEnum::Direction;
+
+Simulator::Simulator(Controller::GroupDispatcher& dispatcher, SimulationConfig config)
+    : dispatcher(dispatcher), config(config) {}
+
+SimulationStats Simulator::run(TrafficGenerator& traffic) {
+    stats = SimulationStats();
+    auto begin = std::chrono::steady_clock::now();
+
+    auto pending = traffic.next();
+    double now = 0.0;
+    while (pending || !events.empty()) {
+        if (pending && (events.empty() || pending->arrivalTime <= events.top().time)) {
+            now = pending->arrivalTime;
+            onArrival(*pending);
+            pending = traffic.next();
+        } else {
+            CarEvent event = events.top();
+            events.pop();
+            now = event.time;
+            onCarAtFloor(event);
+        }
+        stats.events++;
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    stats.simulatedSeconds = now;
+    stats.wallSeconds = std::chrono::duration<double>(end - begin).count();
+    stats.decisions = dispatcher.getDecisions();
+    return stats;
+}
+
+void Simulator::onArrival(const Utility::PassengerRequest& request) {
+    stats.requests++;
+    std::size_t index = dispatcher.dispatch(request);
+    Utility::ElevatorCar& car = dispatcher.getCar(index);
+    if (!car.isMoving()) {
+        // Wake an idle car: it re-evaluates at its current floor right away
+        car.setMoving(true);
+        events.push({request.arrivalTime, index});
+    }
+}
+
+void Simulator::onCarAtFloor(const CarEvent& event) {
+    Utility::ElevatorCar& car = dispatcher.getCar(event.car);
+    bool doorsOpened = false;
+
+    if (car.hasStopAt(car.getFloor())) {
+        scratch.clear();
+        if (car.unload(scratch) > 0) {
+            for (const auto& rider : scratch) {
+                stats.recordTrip(event.time - rider.request.arrivalTime);
+            }
+            doorsOpened = true;
+        }
+    }
+
+    Direction heading = dispatcher.nextDirection(event.car);
+    car.setDirection(heading);
+    scratch.clear();
+    if (car.board(heading, event.time, scratch) > 0) {
+        for (const auto& rider : scratch) {
+            stats.recordWait(event.time - rider.request.arrivalTime);
+        }
+        doorsOpened = true;
+        if (heading == Direction::IDLE) {
+            heading = dispatcher.nextDirection(event.car);
+            car.setDirection(heading);
+        }
+    }
+
+    if (heading == Direction::IDLE) {
+        car.setMoving(false);
+        return;
+    }
+    int nextFloor = car.getFloor() + CommonEnum::directionStep(heading);
+    if (nextFloor < 0 || nextFloor >= car.getFloorCount()) {
+        // Only riders who could not board remain here; try again after the doors cycle
+        events.push({event.time + config.doorDwellTime, event.car});
+        return;
+    }
+    car.setFloor(nextFloor);
+    double departure = event.time + (doorsOpened ? config.doorDwellTime : 0.0);
+    events.push({departure + config.floorTravelTime, event.car});
+}
+
+} // namespace Simulation
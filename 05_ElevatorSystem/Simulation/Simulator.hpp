@@ -0,0 +1,43 @@
+#pragma once
+
+#include <queue>
+#include <vector>
+#include "Controller/GroupDispatcher.hpp"
+#include "Utility/ElevatorCar.hpp"
+#include "SimulationStats.hpp"
+#include "TrafficGenerator.hpp"
+
+namespace Simulation {
+
+struct SimulationConfig {
+    double floorTravelTime = 1.5;  // seconds per floor at cruising speed
+    double doorDwellTime = 5.0;    // seconds per stop, doors open and close
+};
+
+// Discrete-event simulator: the clock jumps straight to the next passenger
+// arrival or car floor-arrival, so a simulated day runs in milliseconds.
+class Simulator {
+private:
+    struct CarEvent {
+        double time;
+        std::size_t car;
+        bool operator>(const CarEvent& other) const { return time > other.time; }
+    };
+
+    Controller::GroupDispatcher& dispatcher;
+    SimulationConfig config;
+    std::priority_queue<CarEvent, std::vector<CarEvent>, std::greater<CarEvent>> events;
+    std::vector<Utility::Rider> scratch;  // reused across events to avoid allocations
+    SimulationStats stats;
+
+public:
+    Simulator(Controller::GroupDispatcher& dispatcher, SimulationConfig config = {});
+
+    SimulationStats run(TrafficGenerator& traffic);
+
+private:
+    void onArrival(const Utility::PassengerRequest& request);
+    void onCarAtFloor(const CarEvent& event);
+};
+
+} // namespace Simulation
@@ -0,0 +1,89 @@
+#include "TrafficGenerator.hpp"
+#include <stdexcept>
+
+namespace Simulation {
+
+namespace {
+constexpr double SECONDS_PER_DAY = 24.0 * 3600.0;
+constexpr double HOUR = 3600.0;
+}
+
+TrafficGenerator::TrafficGenerator(std::vector<TrafficPhase> phases, int floors, int days, uint64_t seed)
+    : phases(std::move(phases)), floors(floors), days(days), day(0), phase(0), clock(0.0), nextId(1), rng(seed) {
+    if (floors < 2) {
+        throw std::invalid_argument("TrafficGenerator: need at least 2 floors");
+    }
+    if (!this->phases.empty()) {
+        clock = this->phases.front().startTime;
+    }
+}
+
+std::vector<TrafficPhase> TrafficGenerator::officeDay(double requestsPerDay) {
+    // Relative weights of each phase's share of the daily trips
+    struct Shape { double start, end, weight, fromLobby, toLobby; };
+    const std::vector<Shape> shapes = {
+        {7.0,  8.0,  0.06, 0.85, 0.05},
+        {8.0,  9.5,  0.30, 0.85, 0.05},   // morning up-peak
+        {9.5,  12.0, 0.10, 0.30, 0.30},
+        {12.0, 13.5, 0.18, 0.45, 0.45},   // lunch
+        {13.5, 17.0, 0.12, 0.30, 0.30},
+        {17.0, 18.5, 0.20, 0.05, 0.85},   // evening down-peak
+        {18.5, 21.0, 0.04, 0.20, 0.60},
+    };
+    std::vector<TrafficPhase> phases;
+    for (const auto& shape : shapes) {
+        double hours = shape.end - shape.start;
+        phases.push_back({shape.start * HOUR, shape.end * HOUR, requestsPerDay * shape.weight / hours,
+                          shape.fromLobby, shape.toLobby});
+    }
+    return phases;
+}
+
+std::optional<Utility::PassengerRequest> TrafficGenerator::next() {
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    while (day < days && phase < phases.size()) {
+        const TrafficPhase& current = phases[phase];
+        if (current.arrivalsPerHour > 0) {
+            std::exponential_distribution<double> gap(current.arrivalsPerHour / HOUR);
+            double candidate = clock + gap(rng);
+            if (candidate < current.endTime) {
+                clock = candidate;
+                Utility::PassengerRequest request;
+                request.id = nextId++;
+                request.arrivalTime = day * SECONDS_PER_DAY + clock;
+                double roll = unit(rng);
+                if (roll < current.fromLobby) {
+                    request.origin = 0;
+                    request.destination = randomUpperFloor();
+                } else if (roll < current.fromLobby + current.toLobby) {
+                    request.origin = randomUpperFloor();
+                    request.destination = 0;
+                } else {
+                    request.origin = randomUpperFloor();
+                    do {
+                        request.destination = randomUpperFloor();
+                    } while (request.destination == request.origin && floors > 2);
+                    if (request.destination == request.origin) {
+                        request.destination = 0;
+                    }
+                }
+                return request;
+            }
+        }
+        // Memoryless arrivals: restarting the clock at the next phase boundary is exact
+        phase++;
+        if (phase == phases.size()) {
+            phase = 0;
+            day++;
+        }
+        clock = phases[phase].startTime;
+    }
+    return std::nullopt;
+}
+
+int TrafficGenerator::randomUpperFloor() {
+    std::uniform_int_distribution<int> floor(1, floors - 1);
+    return floor(rng);
+}
+
+} // namespace Simulation
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+#include "Utility/PassengerRequest.hpp"
+
+namespace Simulation {
+
+// A slice of the day with a constant arrival rate and trip mix.
+// Whatever is not up from / down to the lobby is inter-floor traffic.
+struct TrafficPhase {
+    double startTime;     // seconds since midnight
+    double endTime;
+    double arrivalsPerHour;
+    double fromLobby;     // share of trips lobby -> upper floor
+    double toLobby;       // share of trips upper floor -> lobby
+};
+
+// Streams Poisson arrivals for a piecewise-constant daily profile, one day
+// after another, without materialising the whole request list in memory.
+class TrafficGenerator {
+private:
+    std::vector<TrafficPhase> phases;
+    int floors;
+    int days;
+    int day;
+    std::size_t phase;
+    double clock;  // time within the current day
+    uint64_t nextId;
+    std::mt19937_64 rng;
+
+public:
+    TrafficGenerator(std::vector<TrafficPhase> phases, int floors, int days, uint64_t seed = 42);
+
+    // Office tower profile: morning up-peak, lunch two-way, evening down-peak
+    static std::vector<TrafficPhase> officeDay(double requestsPerDay);
+
+    std::optional<Utility::PassengerRequest> next();
+
+private:
+    int randomUpperFloor();
+};
+
+} // namespace Simulation
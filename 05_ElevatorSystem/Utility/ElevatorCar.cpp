@@ -0,0 +1,75 @@
+#include "ElevatorCar.hpp"
+#include <algorithm>
+
+namespace Utility {
+
+ElevatorCar::ElevatorCar(int id, int floors, int capacity, int startFloor)
+    : id(id), floor(startFloor), capacity(capacity), load(0), moving(false),
+      direction(CommonEnum::Direction::IDLE), pickups(floors), riders(floors),
+      pickupMask(floors), dropMask(floors), pendingPickups(0) {}
+
+void ElevatorCar::assignPickup(const PassengerRequest& request) {
+    pickups[request.origin].push_back(request);
+    pickupMask.set(request.origin);
+    pendingPickups++;
+}
+
+std::size_t ElevatorCar::unload(std::vector<Rider>& out) {
+    auto& leaving = riders[floor];
+    std::size_t count = leaving.size();
+    if (count == 0) {
+        return 0;
+    }
+    out.insert(out.end(), leaving.begin(), leaving.end());
+    leaving.clear();
+    dropMask.clear(floor);
+    load -= static_cast<int>(count);
+    return count;
+}
+
+std::size_t ElevatorCar::board(CommonEnum::Direction towards, double now, std::vector<Rider>& out) {
+    auto& waiting = pickups[floor];
+    std::size_t boarded = 0;
+    // Stable in-place partition: passengers left behind keep their arrival order
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < waiting.size(); i++) {
+        const PassengerRequest& request = waiting[i];
+        bool sameWay = towards == CommonEnum::Direction::IDLE || request.getDirection() == towards;
+        if (sameWay && load < capacity) {
+            Rider rider{request, now};
+            riders[request.destination].push_back(rider);
+            dropMask.set(request.destination);
+            out.push_back(rider);
+            load++;
+            boarded++;
+        } else {
+            waiting[kept++] = request;
+        }
+    }
+    waiting.resize(kept);
+    if (kept == 0) {
+        pickupMask.clear(floor);
+    }
+    pendingPickups -= static_cast<int>(boarded);
+    return boarded;
+}
+
+int ElevatorCar::highestStop() const {
+    return std::max(pickupMask.highest(), dropMask.highest());
+}
+
+int ElevatorCar::lowestStop() const {
+    int low = pickupMask.lowest();
+    int drop = dropMask.lowest();
+    if (low < 0) {
+        return drop;
+    }
+    return drop < 0 ? low : std::min(low, drop);
+}
+
+CommonEnum::Direction ElevatorCar::waitingDirection() const {
+    const auto& waiting = pickups[floor];
+    return waiting.empty() ? CommonEnum::Direction::IDLE : waiting.front().getDirection();
+}
+
+} // namespace Utility
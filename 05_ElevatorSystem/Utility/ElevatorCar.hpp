@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+#include "CommonEnum/Direction.hpp"
+#include "FloorMask.hpp"
+#include "PassengerRequest.hpp"
+
+namespace Utility {
+
+struct Rider {
+    PassengerRequest request;
+    double boardTime;
+};
+
+// One car of the bank with its own request queues: assigned hall calls
+// waiting per floor and riders grouped by destination floor.
+class ElevatorCar {
+private:
+    int id;
+    int floor;
+    int capacity;
+    int load;
+    bool moving;  // a floor-arrival event is pending for this car
+    CommonEnum::Direction direction;
+    std::vector<std::vector<PassengerRequest>> pickups;
+    std::vector<std::vector<Rider>> riders;
+    FloorMask pickupMask;
+    FloorMask dropMask;
+    int pendingPickups;
+
+public:
+    ElevatorCar(int id, int floors, int capacity, int startFloor = 0);
+
+    void assignPickup(const PassengerRequest& request);
+
+    // Move riders for the current floor into `out`; returns how many left the car
+    std::size_t unload(std::vector<Rider>& out);
+    // Board waiting passengers heading `towards` (any direction when IDLE) up to capacity
+    std::size_t board(CommonEnum::Direction towards, double now, std::vector<Rider>& out);
+
+    bool hasStopAt(int at) const { return pickupMask.test(at) || dropMask.test(at); }
+    bool hasWorkAbove(int at) const { return pickupMask.anyAbove(at) || dropMask.anyAbove(at); }
+    bool hasWorkBelow(int at) const { return pickupMask.anyBelow(at) || dropMask.anyBelow(at); }
+    bool hasWork() const { return pendingPickups > 0 || load > 0; }
+    int highestStop() const;
+    int lowestStop() const;
+    // Direction of the first passenger waiting at the current floor, IDLE if none
+    CommonEnum::Direction waitingDirection() const;
+
+    // Getters
+    int getId() const { return id; }
+    int getFloor() const { return floor; }
+    int getLoad() const { return load; }
+    int getCapacity() const { return capacity; }
+    int getPendingPickups() const { return pendingPickups; }
+    int getFloorCount() const { return static_cast<int>(pickups.size()); }
+    bool isMoving() const { return moving; }
+    CommonEnum::Direction getDirection() const { return direction; }
+    const FloorMask& getPickupMask() const { return pickupMask; }
+    const FloorMask& getDropMask() const { return dropMask; }
+
+    void setFloor(int value) { floor = value; }
+    void setMoving(bool value) { moving = value; }
+    void setDirection(CommonEnum::Direction value) { direction = value; }
+};
+
+} // namespace Utility
@@ -0,0 +1,65 @@
+#include "FloorMask.hpp"
+
+namespace Utility {
+
+FloorMask::FloorMask(int floors) : words((floors + 63) / 64 + 1, 0) {}
+
+bool FloorMask::any() const {
+    for (uint64_t word : words) {
+        if (word) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FloorMask::anyAbove(int floor) const {
+    std::size_t index = static_cast<std::size_t>(floor + 1) / 64;
+    int bit = (floor + 1) % 64;
+    if (words[index] >> bit) {
+        return true;
+    }
+    for (std::size_t i = index + 1; i < words.size(); i++) {
+        if (words[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FloorMask::anyBelow(int floor) const {
+    if (floor <= 0) {
+        return false;
+    }
+    std::size_t index = static_cast<std::size_t>(floor) / 64;
+    int bit = floor % 64;
+    if (bit && (words[index] << (64 - bit))) {
+        return true;
+    }
+    for (std::size_t i = 0; i < index; i++) {
+        if (words[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int FloorMask::highest() const {
+    for (std::size_t i = words.size(); i-- > 0;) {
+        if (words[i]) {
+            return static_cast<int>(i * 64 + 63 - __builtin_clzll(words[i]));
+        }
+    }
+    return -1;
+}
+
+int FloorMask::lowest() const {
+    for (std::size_t i = 0; i < words.size(); i++) {
+        if (words[i]) {
+            return static_cast<int>(i * 64 + __builtin_ctzll(words[i]));
+        }
+    }
+    return -1;
+}
+
+} // namespace Utility
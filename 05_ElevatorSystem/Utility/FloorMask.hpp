@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Utility {
+
+// Bitset over floors with word-level "any stop above/below" queries,
+// so direction decisions do not walk every floor of a tall building.
+class FloorMask {
+private:
+    std::vector<uint64_t> words;
+
+public:
+    explicit FloorMask(int floors);
+
+    void set(int floor) { words[floor / 64] |= 1ULL << (floor % 64); }
+    void clear(int floor) { words[floor / 64] &= ~(1ULL << (floor % 64)); }
+    bool test(int floor) const { return (words[floor / 64] >> (floor % 64)) & 1ULL; }
+
+    bool any() const;
+    bool anyAbove(int floor) const;
+    bool anyBelow(int floor) const;
+    // Returns -1 when the mask is empty
+    int highest() const;
+    int lowest() const;
+};
+
+} // namespace Utility
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+#include "CommonEnum/Direction.hpp"
+
+namespace Utility {
+
+// A hall call with its destination known up front (kiosk or car call)
+struct PassengerRequest {
+    uint64_t id = 0;
+    double arrivalTime = 0.0;  // simulated seconds since midnight
+    int origin = 0;
+    int destination = 0;
+
+    CommonEnum::Direction getDirection() const {
+        return destination > origin ? CommonEnum::Direction::UP : CommonEnum::Direction::DOWN;
+    }
+};
+
+} // namespace Utility
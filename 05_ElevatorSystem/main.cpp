@@ -1,2 +1,47 @@
+#include "Controller/GroupDispatcher.hpp"
+#include "Scheduling/ConcreteStrategies/LookStrategy.hpp"
+#include "Scheduling/ConcreteStrategies/ScanStrategy.hpp"
+#include "Scheduling/ConcreteStrategies/DestinationDispatchStrategy.hpp"
+#include "Simulation/Simulator.hpp"
+#include "Simulation/TrafficGenerator.hpp"
+#include <cstdlib>
+#include <iomanip>
 #include <iostream>
-int main() { std::cout << "Elevator System Implementation" << std::endl; return 0; }
+#include <memory>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    std::cout << "Elevator System Implementation" << std::endl;
+
+    // Usage: elevator_system [days] [requestsPerDay]
+    int days = argc > 1 ? std::atoi(argv[1]) : 20;
+    double requestsPerDay = argc > 2 ? std::atof(argv[2]) : 12000.0;
+    const int floors = 40;
+    const int cars = 8;
+    const int capacity = 16;
+
+    std::vector<std::shared_ptr<Scheduling::SchedulingStrategy>> strategies = {
+        std::make_shared<Scheduling::ConcreteStrategies::ScanStrategy>(),
+        std::make_shared<Scheduling::ConcreteStrategies::LookStrategy>(),
+        std::make_shared<Scheduling::ConcreteStrategies::DestinationDispatchStrategy>(),
+    };
+
+    std::cout << floors << " floors, " << cars << " cars, " << days << " day(s) of office traffic" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    for (const auto& strategy : strategies) {
+        Controller::GroupDispatcher dispatcher(floors, cars, capacity, strategy);
+        Simulation::TrafficGenerator traffic(Simulation::TrafficGenerator::officeDay(requestsPerDay), floors, days);
+        Simulation::Simulator simulator(dispatcher);
+        auto stats = simulator.run(traffic);
+
+        std::cout << std::setw(12) << strategy->getName()
+                  << " | requests " << stats.requests
+                  << " | delivered " << stats.delivered
+                  << " | avg wait " << stats.averageWait() << "s"
+                  << " | p95 wait " << stats.waitPercentile(95) << "s"
+                  << " | avg trip " << stats.averageTrip() << "s"
+                  << " | decisions/sec " << static_cast<uint64_t>(stats.decisionsPerSecond())
+                  << " | x" << static_cast<uint64_t>(stats.speedup()) << " real time" << std::endl;
+    }
+    return 0;
+}
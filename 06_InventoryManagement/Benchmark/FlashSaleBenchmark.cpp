@@ -0,0 +1,138 @@
+#include "FlashSaleBenchmark.hpp"
+#include <chrono>
+#include <deque>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace Benchmark {
+
+namespace {
+
+constexpr std::size_t HELD_WINDOW = 64;
+constexpr uint64_t RESTOCK_EVERY = 1000;
+constexpr uint32_t RESTOCK_UNITS = 200;
+
+}
+
+void populateCatalogue(Controller::InventoryService& inventory, const DriverConfig& config) {
+    for (uint64_t sku = 0; sku < config.skus; ++sku) {
+        for (uint16_t warehouse = 0; warehouse < config.warehouses; ++warehouse) {
+            bool hot = sku < config.hotSkus && warehouse == 0;
+            inventory.addSku(sku, warehouse, hot ? config.hotStock : config.stockPerSku, hot ? config.hotStock / 10 : 100);
+        }
+    }
+}
+
+DriverResult runDriver(Controller::InventoryService& inventory, const DriverConfig& config) {
+    std::vector<DriverResult> perThread(config.threads);
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < config.threads; ++t) {
+        workers.emplace_back([&, t] {
+            DriverResult& result = perThread[t];
+            std::mt19937_64 rng(config.seed + t);
+            std::uniform_int_distribution<uint64_t> pickSku(0, config.skus - 1);
+            std::uniform_int_distribution<uint64_t> pickHot(0, config.hotSkus - 1);
+            std::uniform_int_distribution<int> pickWarehouse(0, config.warehouses - 1);
+            std::uniform_int_distribution<int> percent(0, 99);
+            std::uniform_int_distribution<uint32_t> pickQuantity(1, 3);
+            std::deque<std::vector<Utility::OrderLine>> held;
+
+            auto settleOldest = [&] {
+                bool ship = percent(rng) < 50;
+                for (const auto& line : held.front()) {
+                    if (ship) {
+                        inventory.commit(line.sku, line.warehouse, line.quantity);
+                        result.committedUnits += line.quantity;
+                    } else {
+                        inventory.release(line.sku, line.warehouse, line.quantity);
+                    }
+                    ++result.operations;
+                }
+                held.pop_front();
+            };
+
+            for (uint64_t i = 0; i < config.operationsPerThread; ++i) {
+                std::vector<Utility::OrderLine> lines;
+                if (percent(rng) < config.orderPercent) {
+                    int count = 2 + static_cast<int>(rng() % 3);
+                    for (int l = 0; l < count; ++l) {
+                        lines.push_back({pickSku(rng), static_cast<uint16_t>(pickWarehouse(rng)), pickQuantity(rng)});
+                    }
+                    ++result.orders;
+                    if (inventory.reserveOrder(lines) != CommonEnum::ReservationStatus::SUCCESS) {
+                        ++result.orderFailures;
+                        lines.clear();
+                    }
+                } else {
+                    bool hot = percent(rng) < config.hotPercent;
+                    Utility::OrderLine line{hot ? pickHot(rng) : pickSku(rng),
+                                            static_cast<uint16_t>(hot ? 0 : pickWarehouse(rng)), pickQuantity(rng)};
+                    ++result.reservations;
+                    if (inventory.reserve(line.sku, line.warehouse, line.quantity) == CommonEnum::ReservationStatus::SUCCESS) {
+                        lines.push_back(line);
+                    } else {
+                        ++result.reserveFailures;
+                    }
+                }
+                ++result.operations;
+                if (!lines.empty()) {
+                    held.push_back(std::move(lines));
+                    if (held.size() > HELD_WINDOW) {
+                        settleOldest();
+                    }
+                }
+                if (i % RESTOCK_EVERY == RESTOCK_EVERY - 1) {
+                    inventory.restock(pickHot(rng), 0, RESTOCK_UNITS);
+                    result.restockedUnits += RESTOCK_UNITS;
+                    ++result.operations;
+                }
+            }
+            while (!held.empty()) {
+                // Release whatever is still held so the final stock is checkable
+                for (const auto& line : held.front()) {
+                    inventory.release(line.sku, line.warehouse, line.quantity);
+                    ++result.operations;
+                }
+                held.pop_front();
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    DriverResult total;
+    total.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (const auto& result : perThread) {
+        total.reservations += result.reservations;
+        total.reserveFailures += result.reserveFailures;
+        total.orders += result.orders;
+        total.orderFailures += result.orderFailures;
+        total.operations += result.operations;
+        total.committedUnits += result.committedUnits;
+        total.restockedUnits += result.restockedUnits;
+    }
+    return total;
+}
+
+bool verifyStock(Controller::InventoryService& inventory, const DriverConfig& config, const DriverResult& result) {
+    int64_t expected = 0;
+    int64_t actual = 0;
+    for (uint64_t sku = 0; sku < config.skus; ++sku) {
+        for (uint16_t warehouse = 0; warehouse < config.warehouses; ++warehouse) {
+            Utility::StockRecord record;
+            if (!inventory.getStock(sku, warehouse, record) || record.reserved != 0) {
+                return false;
+            }
+            bool hot = sku < config.hotSkus && warehouse == 0;
+            expected += hot ? config.hotStock : config.stockPerSku;
+            actual += record.onHand;
+        }
+    }
+    expected += static_cast<int64_t>(result.restockedUnits) - static_cast<int64_t>(result.committedUnits);
+    return expected == actual;
+}
+
+} // namespace Benchmark
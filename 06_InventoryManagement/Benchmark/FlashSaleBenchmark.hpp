@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include "Controller/InventoryService.hpp"
+
+namespace Benchmark {
+
+struct DriverConfig {
+    int threads = 4;
+    uint64_t operationsPerThread = 500000;
+    uint64_t skus = 100000;
+    uint16_t warehouses = 4;
+    uint64_t hotSkus = 8;           // flash-sale items, listed at warehouse 0
+    int hotPercent = 70;            // share of reservations aimed at hot SKUs
+    int orderPercent = 10;          // share of operations that are multi-SKU orders
+    int64_t stockPerSku = 1000000;
+    int64_t hotStock = 5000;
+    uint64_t seed = 7;
+};
+
+struct DriverResult {
+    uint64_t reservations = 0;      // single-SKU reserve calls
+    uint64_t reserveFailures = 0;
+    uint64_t orders = 0;
+    uint64_t orderFailures = 0;
+    uint64_t operations = 0;        // every call, including release/commit/restock
+    uint64_t committedUnits = 0;
+    uint64_t restockedUnits = 0;
+    double seconds = 0;
+
+    double operationsPerSecond() const { return seconds > 0 ? operations / seconds : 0.0; }
+    // Successful reservations only: single-SKU reserves and whole orders
+    // that were granted
+    double reservationsPerSecond() const {
+        uint64_t granted = reservations - reserveFailures + orders - orderFailures;
+        return seconds > 0 ? granted / seconds : 0.0;
+    }
+    double attemptsPerSecond() const { return seconds > 0 ? (reservations + orders) / seconds : 0.0; }
+};
+
+void populateCatalogue(Controller::InventoryService& inventory, const DriverConfig& config);
+
+// Each thread reserves single SKUs (mostly hot ones) and places 2-4 line
+// orders, keeps a window of held reservations and commits or releases the
+// oldest as it goes, and restocks a hot SKU now and then. Everything still
+// held is released at the end.
+DriverResult runDriver(Controller::InventoryService& inventory, const DriverConfig& config);
+
+// With nothing held, every SKU's reserved count must be zero and on-hand
+// must equal initial stock plus restocks minus commits
+bool verifyStock(Controller::InventoryService& inventory, const DriverConfig& config, const DriverResult& result);
+
+} // namespace Benchmark
@@ -0,0 +1,18 @@
+#include "AlertType.hpp"
+
+namespace CommonEnum {
+
+const char* alertTypeToString(AlertType type) {
+    switch (type) {
+        case AlertType::LOW_STOCK:
+            return "LOW_STOCK";
+        case AlertType::OUT_OF_STOCK:
+            return "OUT_OF_STOCK";
+        case AlertType::RESTOCKED:
+            return "RESTOCKED";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+} // namespace CommonEnum
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CommonEnum {
+
+enum class AlertType : uint8_t {
+    LOW_STOCK,      // available fell below the SKU's threshold
+    OUT_OF_STOCK,   // available reached zero
+    RESTOCKED       // available rose back to the threshold or above
+};
+
+// Utility function to convert AlertType to string
+const char* alertTypeToString(AlertType type);
+
+} // namespace CommonEnum
@@ -0,0 +1,35 @@
+#include "StockOperation.hpp"
+
+namespace CommonEnum {
+
+const char* stockOperationToString(StockOperation operation) {
+    switch (operation) {
+        case StockOperation::RESERVE:
+            return "RESERVE";
+        case StockOperation::RELEASE:
+            return "RELEASE";
+        case StockOperation::COMMIT:
+            return "COMMIT";
+        case StockOperation::RESTOCK:
+            return "RESTOCK";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+const char* reservationStatusToString(ReservationStatus status) {
+    switch (status) {
+        case ReservationStatus::SUCCESS:
+            return "SUCCESS";
+        case ReservationStatus::UNKNOWN_SKU:
+            return "UNKNOWN_SKU";
+        case ReservationStatus::INSUFFICIENT_STOCK:
+            return "INSUFFICIENT_STOCK";
+        case ReservationStatus::INVALID_QUANTITY:
+            return "INVALID_QUANTITY";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+} // namespace CommonEnum
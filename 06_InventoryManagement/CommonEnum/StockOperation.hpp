@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CommonEnum {
+
+enum class StockOperation : uint8_t {
+    RESERVE,    // hold units for an order: reserved += n
+    RELEASE,    // give held units back: reserved -= n
+    COMMIT,     // ship held units: onHand -= n, reserved -= n
+    RESTOCK     // receive units: onHand += n
+};
+
+enum class ReservationStatus {
+    SUCCESS,
+    UNKNOWN_SKU,
+    INSUFFICIENT_STOCK,
+    INVALID_QUANTITY
+};
+
+// Utility functions for stock enums
+const char* stockOperationToString(StockOperation operation);
+const char* reservationStatusToString(ReservationStatus status);
+
+} // namespace CommonEnum
@@ -0,0 +1,296 @@
+#include "InventoryService.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace Controller {
+
+namespace {
+
+// Combining rounds one lock holder runs before leaving the rest to the
+// next caller, so a steady stream of requests cannot pin one thread
+constexpr int MAX_COMBINE_ROUNDS = 8;
+constexpr int SPINS_BEFORE_YIELD = 32;
+
+void bump(std::atomic<uint64_t>& counter, uint64_t amount) {
+    counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+}
+
+InventoryService::InventoryService(const InventoryConfig& config)
+    : config(config), alerts(config.alertCapacity), orders(0), ordersRejected(0) {
+    std::size_t count = 1;
+    while (count < config.shards) {
+        count <<= 1;
+    }
+    shardMask = count - 1;
+    shards = std::make_unique<Shard[]>(count);
+}
+
+bool InventoryService::addSku(uint64_t sku, uint16_t warehouse, int64_t onHand, int64_t lowStockThreshold) {
+    if (sku > Utility::MAX_SKU || onHand < 0) {
+        return false;
+    }
+    Utility::StockKey key = Utility::makeStockKey(sku, warehouse);
+    uint64_t hash = Utility::hashStockKey(key);
+    Shard& shard = shards[shardOf(hash)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    uint32_t slot = static_cast<uint32_t>(shard.stock.size());
+    if (shard.index.insert(key, hash, slot) != slot) {
+        return false;
+    }
+    shard.stock.push_back(Utility::StockRecord{onHand, 0, lowStockThreshold});
+    return true;
+}
+
+CommonEnum::ReservationStatus InventoryService::submit(uint64_t sku, uint16_t warehouse,
+                                                       CommonEnum::StockOperation operation, uint32_t quantity) {
+    if (quantity == 0) {
+        return CommonEnum::ReservationStatus::INVALID_QUANTITY;
+    }
+    if (sku > Utility::MAX_SKU) {
+        return CommonEnum::ReservationStatus::UNKNOWN_SKU;
+    }
+    Utility::StockKey key = Utility::makeStockKey(sku, warehouse);
+    uint64_t hash = Utility::hashStockKey(key);
+    Shard& shard = shards[shardOf(hash)];
+
+    if (!config.batching) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        bump(shard.requests, 1);
+        bump(shard.batches, 1);
+        return applyLocked(shard, key, hash, operation, quantity);
+    }
+
+    Request request{nullptr, key, hash, quantity, operation, CommonEnum::ReservationStatus::SUCCESS, {false}};
+    Request* head = shard.pending.load(std::memory_order_relaxed);
+    do {
+        request.next = head;
+    } while (!shard.pending.compare_exchange_weak(head, &request, std::memory_order_release,
+                                                  std::memory_order_relaxed));
+
+    for (int spins = 0; !request.done.load(std::memory_order_acquire); ++spins) {
+        if (shard.mutex.try_lock()) {
+            combine(shard);
+            shard.mutex.unlock();
+        } else if (spins >= SPINS_BEFORE_YIELD) {
+            std::this_thread::yield();
+        }
+    }
+    return request.status;
+}
+
+void InventoryService::combine(Shard& shard) {
+    for (int round = 0; round < MAX_COMBINE_ROUNDS; ++round) {
+        Request* batch = shard.pending.exchange(nullptr, std::memory_order_acquire);
+        if (batch == nullptr) {
+            return;
+        }
+        // The list is newest first; apply in arrival order
+        Request* ordered = nullptr;
+        while (batch != nullptr) {
+            Request* next = batch->next;
+            batch->next = ordered;
+            ordered = batch;
+            batch = next;
+        }
+        uint64_t applied = 0;
+        while (ordered != nullptr) {
+            // Read next before publishing done: the owner may return and
+            // free its stack frame immediately
+            Request* next = ordered->next;
+            ordered->status = applyLocked(shard, ordered->key, ordered->hash, ordered->operation, ordered->quantity);
+            ordered->done.store(true, std::memory_order_release);
+            ordered = next;
+            ++applied;
+        }
+        bump(shard.requests, applied);
+        bump(shard.batches, 1);
+    }
+}
+
+CommonEnum::ReservationStatus InventoryService::applyLocked(Shard& shard, Utility::StockKey key, uint64_t hash,
+                                                            CommonEnum::StockOperation operation, uint32_t quantity) {
+    uint32_t slot = shard.index.find(key, hash);
+    if (slot == Storage::SkuIndex::INVALID_SLOT) {
+        return CommonEnum::ReservationStatus::UNKNOWN_SKU;
+    }
+    Utility::StockRecord& record = shard.stock[slot];
+    int64_t before = record.available();
+    switch (operation) {
+        case CommonEnum::StockOperation::RESERVE:
+            if (before < quantity) {
+                return CommonEnum::ReservationStatus::INSUFFICIENT_STOCK;
+            }
+            record.reserved += quantity;
+            break;
+        case CommonEnum::StockOperation::RELEASE:
+            if (record.reserved < quantity) {
+                return CommonEnum::ReservationStatus::INVALID_QUANTITY;
+            }
+            record.reserved -= quantity;
+            break;
+        case CommonEnum::StockOperation::COMMIT:
+            if (record.reserved < quantity) {
+                return CommonEnum::ReservationStatus::INVALID_QUANTITY;
+            }
+            record.reserved -= quantity;
+            record.onHand -= quantity;
+            break;
+        case CommonEnum::StockOperation::RESTOCK:
+            record.onHand += quantity;
+            break;
+        default:
+            return CommonEnum::ReservationStatus::INVALID_QUANTITY;
+    }
+    if (record.available() != before) {
+        checkThresholds(key, record, before);
+    }
+    return CommonEnum::ReservationStatus::SUCCESS;
+}
+
+void InventoryService::checkThresholds(Utility::StockKey key, const Utility::StockRecord& record, int64_t before) {
+    int64_t after = record.available();
+    int64_t threshold = record.lowStockThreshold;
+    Utility::StockAlert alert{CommonEnum::AlertType::LOW_STOCK, Utility::skuOf(key), Utility::warehouseOf(key), after};
+    if (after == 0 && before > 0) {
+        alert.type = CommonEnum::AlertType::OUT_OF_STOCK;
+    } else if (after < threshold && before >= threshold) {
+        alert.type = CommonEnum::AlertType::LOW_STOCK;
+    } else if (after >= threshold && before < threshold) {
+        alert.type = CommonEnum::AlertType::RESTOCKED;
+    } else {
+        return;
+    }
+    alerts.publish(alert);
+}
+
+CommonEnum::ReservationStatus InventoryService::reserveOrder(const std::vector<Utility::OrderLine>& lines) {
+    struct Line {
+        Utility::StockKey key;
+        uint64_t hash;
+        uint64_t quantity;
+    };
+    orders.fetch_add(1, std::memory_order_relaxed);
+    auto reject = [this](CommonEnum::ReservationStatus status) {
+        ordersRejected.fetch_add(1, std::memory_order_relaxed);
+        return status;
+    };
+
+    std::vector<Line> merged;
+    merged.reserve(lines.size());
+    for (const auto& line : lines) {
+        if (line.quantity == 0) {
+            return reject(CommonEnum::ReservationStatus::INVALID_QUANTITY);
+        }
+        if (line.sku > Utility::MAX_SKU) {
+            return reject(CommonEnum::ReservationStatus::UNKNOWN_SKU);
+        }
+        Utility::StockKey key = Utility::makeStockKey(line.sku, line.warehouse);
+        merged.push_back(Line{key, Utility::hashStockKey(key), line.quantity});
+    }
+    if (merged.empty()) {
+        return reject(CommonEnum::ReservationStatus::INVALID_QUANTITY);
+    }
+    std::sort(merged.begin(), merged.end(), [](const Line& a, const Line& b) { return a.key < b.key; });
+    std::size_t unique = 0;
+    for (std::size_t i = 1; i < merged.size(); ++i) {
+        if (merged[i].key == merged[unique].key) {
+            merged[unique].quantity += merged[i].quantity;
+        } else {
+            merged[++unique] = merged[i];
+        }
+    }
+    merged.resize(unique + 1);
+
+    // Lock every shard involved in ascending index order, the global order
+    // that keeps concurrent orders from deadlocking
+    std::vector<std::size_t> involved;
+    for (const auto& line : merged) {
+        involved.push_back(shardOf(line.hash));
+    }
+    std::sort(involved.begin(), involved.end());
+    involved.erase(std::unique(involved.begin(), involved.end()), involved.end());
+    for (std::size_t index : involved) {
+        shards[index].mutex.lock();
+    }
+
+    CommonEnum::ReservationStatus status = CommonEnum::ReservationStatus::SUCCESS;
+    for (const auto& line : merged) {
+        Shard& shard = shards[shardOf(line.hash)];
+        uint32_t slot = shard.index.find(line.key, line.hash);
+        if (slot == Storage::SkuIndex::INVALID_SLOT) {
+            status = CommonEnum::ReservationStatus::UNKNOWN_SKU;
+            break;
+        }
+        if (shard.stock[slot].available() < static_cast<int64_t>(line.quantity)) {
+            status = CommonEnum::ReservationStatus::INSUFFICIENT_STOCK;
+            break;
+        }
+    }
+    if (status == CommonEnum::ReservationStatus::SUCCESS) {
+        for (const auto& line : merged) {
+            Shard& shard = shards[shardOf(line.hash)];
+            Utility::StockRecord& record = shard.stock[shard.index.find(line.key, line.hash)];
+            int64_t before = record.available();
+            record.reserved += static_cast<int64_t>(line.quantity);
+            checkThresholds(line.key, record, before);
+        }
+    }
+
+    for (auto index = involved.rbegin(); index != involved.rend(); ++index) {
+        shards[*index].mutex.unlock();
+    }
+    return status == CommonEnum::ReservationStatus::SUCCESS ? status : reject(status);
+}
+
+CommonEnum::ReservationStatus InventoryService::releaseOrder(const std::vector<Utility::OrderLine>& lines) {
+    CommonEnum::ReservationStatus result = CommonEnum::ReservationStatus::SUCCESS;
+    for (const auto& line : lines) {
+        CommonEnum::ReservationStatus status = release(line.sku, line.warehouse, line.quantity);
+        if (result == CommonEnum::ReservationStatus::SUCCESS) {
+            result = status;
+        }
+    }
+    return result;
+}
+
+CommonEnum::ReservationStatus InventoryService::commitOrder(const std::vector<Utility::OrderLine>& lines) {
+    CommonEnum::ReservationStatus result = CommonEnum::ReservationStatus::SUCCESS;
+    for (const auto& line : lines) {
+        CommonEnum::ReservationStatus status = commit(line.sku, line.warehouse, line.quantity);
+        if (result == CommonEnum::ReservationStatus::SUCCESS) {
+            result = status;
+        }
+    }
+    return result;
+}
+
+bool InventoryService::getStock(uint64_t sku, uint16_t warehouse, Utility::StockRecord& record) {
+    if (sku > Utility::MAX_SKU) {
+        return false;
+    }
+    Utility::StockKey key = Utility::makeStockKey(sku, warehouse);
+    uint64_t hash = Utility::hashStockKey(key);
+    Shard& shard = shards[shardOf(hash)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    uint32_t slot = shard.index.find(key, hash);
+    if (slot == Storage::SkuIndex::INVALID_SLOT) {
+        return false;
+    }
+    record = shard.stock[slot];
+    return true;
+}
+
+InventoryStats InventoryService::getStats() const {
+    InventoryStats stats;
+    for (std::size_t i = 0; i <= shardMask; ++i) {
+        stats.requests += shards[i].requests.load(std::memory_order_relaxed);
+        stats.batches += shards[i].batches.load(std::memory_order_relaxed);
+    }
+    stats.orders = orders.load(std::memory_order_relaxed);
+    stats.ordersRejected = ordersRejected.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace Controller
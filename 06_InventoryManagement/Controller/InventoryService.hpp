@@ -0,0 +1,123 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "CommonEnum/StockOperation.hpp"
+#include "Storage/SkuIndex.hpp"
+#include "Stream/AlertStream.hpp"
+#include "Utility/StockKey.hpp"
+#include "Utility/StockRecord.hpp"
+
+namespace Controller {
+
+struct InventoryConfig {
+    std::size_t shards = 64;            // rounded up to a power of two
+    bool batching = true;               // false: every request takes its shard lock itself
+    std::size_t alertCapacity = 1 << 16;
+};
+
+struct InventoryStats {
+    uint64_t requests = 0;      // single-SKU operations applied
+    uint64_t batches = 0;       // shard lock acquisitions that applied them
+    uint64_t orders = 0;        // multi-SKU orders attempted
+    uint64_t ordersRejected = 0;
+
+    double averageBatch() const { return batches > 0 ? static_cast<double>(requests) / batches : 0.0; }
+};
+
+// Stock for SKUs across warehouses, split into shards by key hash. Each
+// shard owns an open-addressing index and a flat array of stock records.
+//
+// Single-SKU operations are batched per shard by flat combining: a caller
+// pushes its request onto the shard's lock-free pending list, and whoever
+// holds the shard lock applies every pending request in one pass. During
+// a flash sale, when all buyers hit the same few SKUs, one lock
+// acquisition serves a whole burst of callers instead of handing the
+// lock (and its cache line) from thread to thread.
+//
+// Multi-SKU orders are all-or-nothing: the shards involved are locked in
+// ascending order, every line is checked, and only then reserved.
+class InventoryService {
+private:
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    // Lives on the calling thread's stack until the combiner marks it done
+    struct Request {
+        Request* next;
+        Utility::StockKey key;
+        uint64_t hash;
+        uint32_t quantity;
+        CommonEnum::StockOperation operation;
+        CommonEnum::ReservationStatus status;
+        std::atomic<bool> done;
+    };
+
+    struct alignas(CACHE_LINE) Shard {
+        std::mutex mutex;
+        std::atomic<Request*> pending;
+        Storage::SkuIndex index;
+        std::vector<Utility::StockRecord> stock;   // by slot
+        // Written under the shard lock, read by getStats()
+        std::atomic<uint64_t> requests;
+        std::atomic<uint64_t> batches;
+
+        Shard() : pending(nullptr), requests(0), batches(0) {}
+    };
+
+    InventoryConfig config;
+    std::size_t shardMask;
+    std::unique_ptr<Shard[]> shards;
+    Stream::AlertStream alerts;
+    std::atomic<uint64_t> orders;
+    std::atomic<uint64_t> ordersRejected;
+
+    std::size_t shardOf(uint64_t hash) const { return static_cast<std::size_t>(hash >> 40) & shardMask; }
+
+    CommonEnum::ReservationStatus submit(uint64_t sku, uint16_t warehouse, CommonEnum::StockOperation operation,
+                                         uint32_t quantity);
+    void combine(Shard& shard);
+    // Caller holds the shard lock
+    CommonEnum::ReservationStatus applyLocked(Shard& shard, Utility::StockKey key, uint64_t hash,
+                                              CommonEnum::StockOperation operation, uint32_t quantity);
+    void checkThresholds(Utility::StockKey key, const Utility::StockRecord& record, int64_t before);
+
+public:
+    explicit InventoryService(const InventoryConfig& config = InventoryConfig());
+
+    // Returns false if the SKU is already stocked at that warehouse or the
+    // SKU code is out of range
+    bool addSku(uint64_t sku, uint16_t warehouse, int64_t onHand, int64_t lowStockThreshold);
+
+    // SKU codes above Utility::MAX_SKU are UNKNOWN_SKU everywhere rather
+    // than aliasing another SKU's packed key
+    CommonEnum::ReservationStatus reserve(uint64_t sku, uint16_t warehouse, uint32_t quantity) {
+        return submit(sku, warehouse, CommonEnum::StockOperation::RESERVE, quantity);
+    }
+    CommonEnum::ReservationStatus release(uint64_t sku, uint16_t warehouse, uint32_t quantity) {
+        return submit(sku, warehouse, CommonEnum::StockOperation::RELEASE, quantity);
+    }
+    CommonEnum::ReservationStatus commit(uint64_t sku, uint16_t warehouse, uint32_t quantity) {
+        return submit(sku, warehouse, CommonEnum::StockOperation::COMMIT, quantity);
+    }
+    CommonEnum::ReservationStatus restock(uint64_t sku, uint16_t warehouse, uint32_t quantity) {
+        return submit(sku, warehouse, CommonEnum::StockOperation::RESTOCK, quantity);
+    }
+
+    // Reserves every line or none of them; repeated SKUs are summed
+    CommonEnum::ReservationStatus reserveOrder(const std::vector<Utility::OrderLine>& lines);
+    // Per line; returns the first failure, if any
+    CommonEnum::ReservationStatus releaseOrder(const std::vector<Utility::OrderLine>& lines);
+    CommonEnum::ReservationStatus commitOrder(const std::vector<Utility::OrderLine>& lines);
+
+    bool getStock(uint64_t sku, uint16_t warehouse, Utility::StockRecord& record);
+
+    // Getters
+    Stream::AlertStream& getAlerts() { return alerts; }
+    std::size_t getShardCount() const { return shardMask + 1; }
+    InventoryStats getStats() const;
+};
+
+} // namespace Controller
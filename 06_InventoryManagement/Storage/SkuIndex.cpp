@@ -0,0 +1,47 @@
+#include "SkuIndex.hpp"
+
+namespace Storage {
+
+SkuIndex::SkuIndex(std::size_t capacity) : count(0) {
+    std::size_t size = 16;
+    while (size < capacity * 2) {
+        size <<= 1;
+    }
+    entries.assign(size, Entry{EMPTY, INVALID_SLOT});
+    mask = size - 1;
+}
+
+uint32_t SkuIndex::insert(Utility::StockKey key, uint64_t hash, uint32_t slot) {
+    if ((count + 1) * 2 > entries.size()) {
+        grow();
+    }
+    for (std::size_t bucket = hash & mask;; bucket = (bucket + 1) & mask) {
+        Entry& entry = entries[bucket];
+        if (entry.key == key) {
+            return entry.slot;
+        }
+        if (entry.key == EMPTY) {
+            entry = Entry{key, slot};
+            ++count;
+            return slot;
+        }
+    }
+}
+
+void SkuIndex::grow() {
+    std::vector<Entry> old;
+    old.swap(entries);
+    entries.assign(old.size() * 2, Entry{EMPTY, INVALID_SLOT});
+    mask = entries.size() - 1;
+    for (const Entry& entry : old) {
+        if (entry.key != EMPTY) {
+            std::size_t bucket = Utility::hashStockKey(entry.key) & mask;
+            while (entries[bucket].key != EMPTY) {
+                bucket = (bucket + 1) & mask;
+            }
+            entries[bucket] = entry;
+        }
+    }
+}
+
+} // namespace Storage
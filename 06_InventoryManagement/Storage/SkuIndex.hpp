@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Utility/StockKey.hpp"
+
+namespace Storage {
+
+// Open-addressing StockKey -> slot map with linear probing. Key and slot
+// share one 16-byte entry, so a hit usually costs a single cache line;
+// the table doubles at 50% load. Callers pass hashStockKey(key) so the
+// hash is computed once per request for both shard and bucket selection.
+// Not synchronized: each shard guards its own index.
+class SkuIndex {
+public:
+    static constexpr uint32_t INVALID_SLOT = UINT32_MAX;
+
+private:
+    static constexpr Utility::StockKey EMPTY = UINT64_MAX;
+
+    struct Entry {
+        Utility::StockKey key;
+        uint32_t slot;
+    };
+
+    std::vector<Entry> entries;
+    std::size_t mask;
+    std::size_t count;
+
+    void grow();
+
+public:
+    explicit SkuIndex(std::size_t capacity = 64);
+
+    uint32_t find(Utility::StockKey key, uint64_t hash) const {
+        for (std::size_t bucket = hash & mask;; bucket = (bucket + 1) & mask) {
+            const Entry& entry = entries[bucket];
+            if (entry.key == key) {
+                return entry.slot;
+            }
+            if (entry.key == EMPTY) {
+                return INVALID_SLOT;
+            }
+        }
+    }
+
+    // Returns the slot already mapped to key, or maps it to slot
+    uint32_t insert(Utility::StockKey key, uint64_t hash, uint32_t slot);
+
+    // Getters
+    std::size_t getSize() const { return count; }
+    std::size_t getCapacity() const { return entries.size(); }
+};
+
+} // namespace Storage
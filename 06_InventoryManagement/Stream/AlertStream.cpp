@@ -0,0 +1,46 @@
+#include "AlertStream.hpp"
+
+namespace Stream {
+
+AlertStream::AlertStream(std::size_t capacity) : capacity(capacity), published(0), dropped(0) {}
+
+void AlertStream::publish(const Utility::StockAlert& alert) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (alerts.size() >= capacity) {
+            ++dropped;
+            return;
+        }
+        alerts.push_back(alert);
+        ++published;
+    }
+    available.notify_one();
+}
+
+std::size_t AlertStream::poll(std::vector<Utility::StockAlert>& out, std::size_t max) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t taken = 0;
+    while (taken < max && !alerts.empty()) {
+        out.push_back(alerts.front());
+        alerts.pop_front();
+        ++taken;
+    }
+    return taken;
+}
+
+bool AlertStream::waitFor(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return available.wait_for(lock, timeout, [this] { return !alerts.empty(); });
+}
+
+uint64_t AlertStream::getPublished() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return published;
+}
+
+uint64_t AlertStream::getDropped() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return dropped;
+}
+
+} // namespace Stream
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+#include "Utility/StockRecord.hpp"
+
+namespace Stream {
+
+// Bounded queue of stock alerts for downstream consumers (replenishment,
+// dashboards). Alerts fire only when a threshold is crossed, so this is
+// far off the reservation hot path; once full, new alerts are counted
+// and discarded rather than stalling a shard.
+class AlertStream {
+private:
+    std::size_t capacity;
+    std::deque<Utility::StockAlert> alerts;
+    uint64_t published;
+    uint64_t dropped;
+    mutable std::mutex mutex;
+    std::condition_variable available;
+
+public:
+    explicit AlertStream(std::size_t capacity);
+
+    void publish(const Utility::StockAlert& alert);
+    // Moves up to max alerts into out; returns how many
+    std::size_t poll(std::vector<Utility::StockAlert>& out, std::size_t max);
+    // Waits until an alert is queued or the timeout passes
+    bool waitFor(std::chrono::milliseconds timeout);
+
+    // Getters
+    uint64_t getPublished() const;
+    uint64_t getDropped() const;
+};
+
+} // namespace Stream
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Utility {
+
+// A SKU at one warehouse packed into 64 bits: 48-bit SKU, 16-bit warehouse
+using StockKey = uint64_t;
+
+constexpr uint64_t MAX_SKU = (1ULL << 48) - 2;   // all-ones is the index's empty marker
+
+inline StockKey makeStockKey(uint64_t sku, uint16_t warehouse) {
+    return (sku << 16) | warehouse;
+}
+
+inline uint64_t skuOf(StockKey key) { return key >> 16; }
+inline uint16_t warehouseOf(StockKey key) { return static_cast<uint16_t>(key); }
+
+// Finalizer from MurmurHash3: SKU codes are often sequential, so spread
+// them before taking shard and bucket bits
+inline uint64_t hashStockKey(StockKey key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return key;
+}
+
+} // namespace Utility
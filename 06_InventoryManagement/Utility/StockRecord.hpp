@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include "CommonEnum/AlertType.hpp"
+
+namespace Utility {
+
+struct StockRecord {
+    int64_t onHand;
+    int64_t reserved;
+    int64_t lowStockThreshold;
+
+    int64_t available() const { return onHand - reserved; }
+};
+
+struct OrderLine {
+    uint64_t sku;
+    uint16_t warehouse;
+    uint32_t quantity;
+};
+
+struct StockAlert {
+    CommonEnum::AlertType type;
+    uint64_t sku;
+    uint16_t warehouse;
+    int64_t available;
+};
+
+} // namespace Utility
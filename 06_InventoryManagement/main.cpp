@@ -0,0 +1,81 @@
+#include "Controller/InventoryService.hpp"
+#include "Benchmark/FlashSaleBenchmark.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+int main(int argc, char* argv[]) {
+    std::cout << "Inventory Management Implementation" << std::endl;
+
+    Controller::InventoryService inventory;
+    inventory.addSku(1001, 0, 10, 3);
+    inventory.addSku(1002, 0, 5, 2);
+    inventory.addSku(1002, 1, 50, 10);
+
+    std::cout << "Reserve 8 x 1001: "
+              << CommonEnum::reservationStatusToString(inventory.reserve(1001, 0, 8)) << std::endl;
+    std::cout << "Order 2 x 1001 + 6 x 1002@0 (all or nothing): "
+              << CommonEnum::reservationStatusToString(inventory.reserveOrder({{1001, 0, 2}, {1002, 0, 6}})) << std::endl;
+    std::cout << "Order 2 x 1001 + 6 x 1002@1: "
+              << CommonEnum::reservationStatusToString(inventory.reserveOrder({{1001, 0, 2}, {1002, 1, 6}})) << std::endl;
+    std::cout << "Unknown SKU: " << CommonEnum::reservationStatusToString(inventory.reserve(9999, 0, 1)) << std::endl;
+    std::cout << "SKU 1001 + 2^48 (out of range): "
+              << CommonEnum::reservationStatusToString(inventory.reserve(1001 + (1ULL << 48), 0, 1)) << std::endl;
+    inventory.commit(1001, 0, 8);
+    inventory.release(1001, 0, 2);
+    inventory.restock(1001, 0, 20);
+
+    Utility::StockRecord record;
+    inventory.getStock(1001, 0, record);
+    std::cout << "SKU 1001: on hand " << record.onHand << ", reserved " << record.reserved << std::endl;
+    std::vector<Utility::StockAlert> alerts;
+    inventory.getAlerts().poll(alerts, 100);
+    for (const auto& alert : alerts) {
+        std::cout << "  alert " << CommonEnum::alertTypeToString(alert.type) << " sku " << alert.sku << "@"
+                  << alert.warehouse << " available " << alert.available << std::endl;
+    }
+
+    // Flash-sale driver: per-shard batching (flat combining) against one
+    // lock acquisition per request
+    Benchmark::DriverConfig config;
+    config.operationsPerThread = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 500000;
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << "\n" << config.skus << " SKUs x " << config.warehouses << " warehouses, " << config.hotSkus
+              << " hot SKUs, " << cores << " hardware threads" << std::endl;
+    for (int threads : {1, 4, 16}) {
+        for (bool batching : {false, true}) {
+            Controller::InventoryConfig inventoryConfig;
+            inventoryConfig.batching = batching;
+            Controller::InventoryService service(inventoryConfig);
+            config.threads = threads;
+            Benchmark::populateCatalogue(service, config);
+
+            uint64_t alertCount = 0;
+            std::atomic<bool> done{false};
+            std::thread alertConsumer([&] {
+                std::vector<Utility::StockAlert> batch;
+                while (!done.load()) {
+                    if (service.getAlerts().waitFor(std::chrono::milliseconds(5))) {
+                        batch.clear();
+                        alertCount += service.getAlerts().poll(batch, 1024);
+                    }
+                }
+            });
+            Benchmark::DriverResult result = Benchmark::runDriver(service, config);
+            done.store(true);
+            alertConsumer.join();
+
+            Controller::InventoryStats stats = service.getStats();
+            std::printf("%2d threads %-9s %.2fM reservations/s granted of %.2fM attempted (%.2fM ops/s)  failed %.1f%%  orders rejected %.1f%%  "
+                        "avg batch %.2f  alerts %llu  stock %s\n",
+                        threads, batching ? "batched" : "locked", result.reservationsPerSecond() / 1e6,
+                        result.attemptsPerSecond() / 1e6, result.operationsPerSecond() / 1e6,
+                        100.0 * result.reserveFailures / std::max<uint64_t>(1, result.reservations),
+                        100.0 * result.orderFailures / std::max<uint64_t>(1, result.orders), stats.averageBatch(),
+                        static_cast<unsigned long long>(alertCount),
+                        Benchmark::verifyStock(service, config, result) ? "consistent" : "MISMATCH");
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,252 @@
+#include "SearchBenchmark.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace Benchmark {
+
+ReservationLists::ReservationLists(const Controller::RentalService& service, uint32_t branches)
+    : reservations(service.getVehicleCount()), groupVehicles(branches * CommonEnum::VEHICLE_CLASS_COUNT),
+      branches(branches) {
+    for (uint32_t id = 0; id < service.getVehicleCount(); ++id) {
+        const Utility::Vehicle& vehicle = service.getVehicle(id);
+        groupVehicles[static_cast<uint32_t>(vehicle.vehicleClass) * branches + vehicle.branch].push_back(id);
+    }
+}
+
+void ReservationLists::add(uint32_t vehicleId, uint32_t startDay, uint32_t endDay) {
+    reservations[vehicleId].emplace_back(startDay, endDay);
+}
+
+std::size_t ReservationLists::searchAvailable(uint32_t branch, CommonEnum::VehicleClass vehicleClass,
+                                              uint32_t startDay, uint32_t endDay, std::vector<uint32_t>& out) const {
+    std::size_t found = 0;
+    for (uint32_t vehicle : groupVehicles[static_cast<uint32_t>(vehicleClass) * branches + branch]) {
+        bool free = true;
+        for (const auto& reservation : reservations[vehicle]) {
+            if (reservation.first < endDay && startDay < reservation.second) {
+                free = false;
+                break;
+            }
+        }
+        if (free) {
+            out.push_back(vehicle);
+            ++found;
+        }
+    }
+    return found;
+}
+
+void buildFleet(Controller::RentalService& service, uint32_t vehicles, uint32_t branches) {
+    for (uint32_t i = 0; i < vehicles; ++i) {
+        uint32_t branch = i % branches;
+        auto vehicleClass = static_cast<CommonEnum::VehicleClass>(i / branches % CommonEnum::VEHICLE_CLASS_COUNT);
+        service.addVehicle("CAR-" + std::to_string(i), branch, vehicleClass);
+    }
+}
+
+double prefillBookings(Controller::RentalService& service, ReservationLists& baseline, std::mt19937_64& rng) {
+    std::uniform_int_distribution<uint32_t> pickGap(0, 8);
+    std::uniform_int_distribution<uint32_t> pickLength(1, 7);
+    uint64_t bookedDays = 0;
+    for (uint32_t vehicle = 0; vehicle < service.getVehicleCount(); ++vehicle) {
+        uint32_t day = pickGap(rng);
+        while (true) {
+            uint32_t end = day + pickLength(rng);
+            if (end > service.getHorizonDays()) {
+                break;
+            }
+            uint64_t bookingId;
+            service.book(vehicle, day, end, bookingId);
+            baseline.add(vehicle, day, end);
+            bookedDays += end - day;
+            day = end + pickGap(rng);
+        }
+    }
+    return static_cast<double>(bookedDays) / (static_cast<double>(service.getVehicleCount()) * service.getHorizonDays());
+}
+
+std::vector<QueryResult> runQueryBenchmark(const Controller::RentalService& service, const ReservationLists& baseline,
+                                           uint32_t branches, uint64_t queries, uint64_t seed) {
+    struct Query {
+        uint32_t branch;
+        CommonEnum::VehicleClass vehicleClass;
+        uint32_t startDay;
+        uint32_t endDay;
+    };
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<uint32_t> pickBranch(0, branches - 1);
+    std::uniform_int_distribution<int> pickClass(0, CommonEnum::VEHICLE_CLASS_COUNT - 1);
+    std::uniform_int_distribution<uint32_t> pickLength(1, 14);
+    std::vector<Query> workload;
+    for (uint64_t i = 0; i < queries; ++i) {
+        Query query{pickBranch(rng), static_cast<CommonEnum::VehicleClass>(pickClass(rng)), 0, 0};
+        uint32_t length = pickLength(rng);
+        query.startDay = static_cast<uint32_t>(rng() % (service.getHorizonDays() - length));
+        query.endDay = query.startDay + length;
+        workload.push_back(query);
+    }
+
+    auto measure = [&](const char* name, auto search) {
+        QueryResult result{name, queries, 0, 0, 0, 0};
+        std::vector<double> latencies;
+        latencies.reserve(queries);
+        std::vector<uint32_t> out;
+        auto start = std::chrono::steady_clock::now();
+        for (const Query& query : workload) {
+            out.clear();
+            auto before = std::chrono::steady_clock::now();
+            result.matches += search(query, out);
+            latencies.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - before).count());
+        }
+        result.meanNanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / queries;
+        std::sort(latencies.begin(), latencies.end());
+        result.p50Nanos = latencies[latencies.size() / 2];
+        result.p99Nanos = latencies[static_cast<std::size_t>(latencies.size() * 0.99)];
+        return result;
+    };
+
+    std::vector<QueryResult> results;
+    results.push_back(measure("day bitsets", [&](const Query& query, std::vector<uint32_t>& out) {
+        return service.searchAvailable(query.branch, query.vehicleClass, query.startDay, query.endDay, out);
+    }));
+    results.push_back(measure("reservation lists", [&](const Query& query, std::vector<uint32_t>& out) {
+        return baseline.searchAvailable(query.branch, query.vehicleClass, query.startDay, query.endDay, out);
+    }));
+    return results;
+}
+
+BookingResult runConcurrentBooking(Controller::RentalService& service, uint32_t branches, int threads,
+                                   uint64_t operationsPerThread, uint64_t seed) {
+    std::vector<BookingResult> perThread(threads);
+    std::vector<std::thread> workers;
+    uint64_t conflictsBefore = service.getConflicts();
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            BookingResult& result = perThread[t];
+            std::mt19937_64 rng(seed + t);
+            // Few branches and classes so threads compete for the same cars
+            std::uniform_int_distribution<uint32_t> pickBranch(0, std::min<uint32_t>(branches, 4) - 1);
+            std::uniform_int_distribution<int> pickClass(0, 1);
+            std::uniform_int_distribution<uint32_t> pickLength(1, 5);
+            std::uniform_int_distribution<int> percent(0, 99);
+            std::vector<uint64_t> mine;
+            std::vector<uint32_t> out;
+            for (uint64_t i = 0; i < operationsPerThread; ++i) {
+                uint32_t branch = pickBranch(rng);
+                auto vehicleClass = static_cast<CommonEnum::VehicleClass>(pickClass(rng));
+                uint32_t length = pickLength(rng);
+                uint32_t startDay = static_cast<uint32_t>(rng() % 30);
+                int roll = percent(rng);
+                if (roll < 60) {
+                    out.clear();
+                    service.searchAvailable(branch, vehicleClass, startDay, startDay + length, out);
+                    ++result.searches;
+                } else if (roll < 90 || mine.empty()) {
+                    uint64_t bookingId;
+                    uint32_t vehicleId;
+                    if (service.bookAny(branch, vehicleClass, startDay, startDay + length, bookingId, vehicleId)
+                            == CommonEnum::BookingStatus::SUCCESS) {
+                        mine.push_back(bookingId);
+                        ++result.bookings;
+                    } else {
+                        ++result.notAvailable;
+                    }
+                } else {
+                    std::size_t pick = rng() % mine.size();
+                    service.cancel(mine[pick]);
+                    mine[pick] = mine.back();
+                    mine.pop_back();
+                    ++result.cancels;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    BookingResult total{0, 0, 0, 0, 0, 0};
+    total.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (const auto& result : perThread) {
+        total.searches += result.searches;
+        total.bookings += result.bookings;
+        total.notAvailable += result.notAvailable;
+        total.cancels += result.cancels;
+    }
+    total.conflicts = service.getConflicts() - conflictsBefore;
+    return total;
+}
+
+bool verifyCalendar(Controller::RentalService& service) {
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> active(service.getVehicleCount());
+    for (const auto& booking : service.getBookings()) {
+        if (booking.active) {
+            active[booking.vehicle].emplace_back(booking.startDay, booking.endDay);
+        }
+    }
+    std::vector<bool> covered(service.getHorizonDays());
+    for (uint32_t vehicle = 0; vehicle < active.size(); ++vehicle) {
+        auto& ranges = active[vehicle];
+        std::sort(ranges.begin(), ranges.end());
+        std::fill(covered.begin(), covered.end(), false);
+        for (std::size_t i = 0; i < ranges.size(); ++i) {
+            if (i > 0 && ranges[i].first < ranges[i - 1].second) {
+                return false;
+            }
+            for (uint32_t day = ranges[i].first; day < ranges[i].second; ++day) {
+                covered[day] = true;
+            }
+        }
+        for (uint32_t day = 0; day < service.getHorizonDays(); ++day) {
+            if (service.isAvailable(vehicle, day, day + 1) == covered[day]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool verifyConcurrentClaims(int threads, uint32_t rounds) {
+    constexpr uint32_t STAY = 6;
+    constexpr uint32_t STEP = 3;
+    Controller::RentalService service(STEP * threads + STAY);
+    uint32_t vehicle = service.addVehicle("RACE", 0, CommonEnum::VehicleClass::COMPACT);
+    std::vector<CommonEnum::BookingStatus> statuses(threads);
+    std::vector<uint64_t> bookingIds(threads);
+    for (uint32_t round = 0; round < rounds; ++round) {
+        std::atomic<int> ready(0);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                ready.fetch_add(1);
+                while (ready.load() < threads) {
+                    std::this_thread::yield();
+                }
+                statuses[t] = service.book(vehicle, t * STEP, t * STEP + STAY, bookingIds[t]);
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (int t = 0; t < threads; ++t) {
+            if (statuses[t] == CommonEnum::BookingStatus::SUCCESS) {
+                continue;
+            }
+            bool beforeWon = t > 0 && statuses[t - 1] == CommonEnum::BookingStatus::SUCCESS;
+            bool afterWon = t + 1 < threads && statuses[t + 1] == CommonEnum::BookingStatus::SUCCESS;
+            if (statuses[t] != CommonEnum::BookingStatus::CONFLICT || (!beforeWon && !afterWon)) {
+                return false;
+            }
+        }
+        for (int t = 0; t < threads; ++t) {
+            if (statuses[t] == CommonEnum::BookingStatus::SUCCESS) {
+                service.cancel(bookingIds[t]);
+            }
+        }
+    }
+    return verifyCalendar(service);
+}
+
+} // namespace Benchmark
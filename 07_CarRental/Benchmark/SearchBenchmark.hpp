@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "Controller/RentalService.hpp"
+
+namespace Benchmark {
+
+// Baseline: per-vehicle reservation lists, searched by checking every
+// reservation of every vehicle in the group for overlap
+class ReservationLists {
+private:
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> reservations;   // by vehicle id
+    std::vector<std::vector<uint32_t>> groupVehicles;                       // by (branch, class)
+    uint32_t branches;
+
+public:
+    ReservationLists(const Controller::RentalService& service, uint32_t branches);
+
+    void add(uint32_t vehicleId, uint32_t startDay, uint32_t endDay);
+    std::size_t searchAvailable(uint32_t branch, CommonEnum::VehicleClass vehicleClass, uint32_t startDay,
+                                uint32_t endDay, std::vector<uint32_t>& out) const;
+};
+
+struct QueryResult {
+    const char* name;
+    uint64_t queries;
+    uint64_t matches;
+    double p50Nanos;
+    double p99Nanos;
+    double meanNanos;
+};
+
+struct BookingResult {
+    uint64_t searches;
+    uint64_t bookings;
+    uint64_t notAvailable;
+    uint64_t cancels;
+    uint64_t conflicts;
+    double seconds;
+};
+
+// branches x 6 classes, vehicles spread round-robin
+void buildFleet(Controller::RentalService& service, uint32_t vehicles, uint32_t branches);
+
+// Books back-to-back random stays with random gaps on every vehicle,
+// mirroring them into the baseline; returns the booked share of days
+double prefillBookings(Controller::RentalService& service, ReservationLists& baseline, std::mt19937_64& rng);
+
+// Random (branch, class, start, 1-14 days) searches through both indexes
+std::vector<QueryResult> runQueryBenchmark(const Controller::RentalService& service, const ReservationLists& baseline,
+                                           uint32_t branches, uint64_t queries, uint64_t seed);
+
+// threads mixing searches, bookAny and cancels of their own bookings
+BookingResult runConcurrentBooking(Controller::RentalService& service, uint32_t branches, int threads,
+                                   uint64_t operationsPerThread, uint64_t seed);
+
+// No two active bookings of a vehicle overlap, and every day of every
+// vehicle is free exactly when no active booking covers it
+bool verifyCalendar(Controller::RentalService& service);
+
+// Round after round, threads race to book a chain of overlapping stays on
+// one vehicle (each overlaps only its neighbours). A refused booking must
+// overlap one that succeeded in the same round: a claim that lost only to
+// another claim that later rolled back is a false conflict.
+bool verifyConcurrentClaims(int threads, uint32_t rounds);
+
+} // namespace Benchmark
@@ -0,0 +1,113 @@
+#include "AvailabilityGrid.hpp"
+#include <thread>
+
+namespace Calendar {
+
+AvailabilityGrid::AvailabilityGrid(uint32_t days) : days(days), vehicleCount(0) {}
+
+uint32_t AvailabilityGrid::addVehicle() {
+    uint32_t index = vehicleCount++;
+    if (index % BITS == 0) {
+        // Columns of vehicles not yet added stay 0 so searches never see them
+        blocks.push_back(std::make_unique<std::atomic<uint64_t>[]>(days));
+        for (uint32_t day = 0; day < days; ++day) {
+            blocks.back()[day].store(0, std::memory_order_relaxed);
+        }
+        claimWords.push_back(std::make_unique<std::atomic<uint64_t>[]>(BITS));
+        for (uint32_t i = 0; i < BITS; ++i) {
+            claimWords.back()[i].store(0, std::memory_order_relaxed);
+        }
+    }
+    std::atomic<uint64_t>* block = blocks[index / BITS].get();
+    for (uint32_t day = 0; day < days; ++day) {
+        block[day].fetch_or(bitOf(index), std::memory_order_relaxed);
+    }
+    return index;
+}
+
+std::size_t AvailabilityGrid::findFree(uint32_t startDay, uint32_t endDay, std::vector<uint32_t>& out,
+                                       std::size_t limit) const {
+    std::size_t found = 0;
+    for (std::size_t b = 0; b < blocks.size() && found < limit; ++b) {
+        const std::atomic<uint64_t>* block = blocks[b].get();
+        uint64_t free = ~0ULL;
+        for (uint32_t day = startDay; day < endDay && free != 0; ++day) {
+            free &= block[day].load(std::memory_order_relaxed);
+        }
+        while (free != 0 && found < limit) {
+            out.push_back(static_cast<uint32_t>(b * BITS + __builtin_ctzll(free)));
+            free &= free - 1;
+            ++found;
+        }
+    }
+    return found;
+}
+
+bool AvailabilityGrid::isFree(uint32_t index, uint32_t startDay, uint32_t endDay) const {
+    const std::atomic<uint64_t>* block = blocks[index / BITS].get();
+    uint64_t bit = bitOf(index);
+    for (uint32_t day = startDay; day < endDay; ++day) {
+        if ((block[day].load(std::memory_order_relaxed) & bit) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool AvailabilityGrid::claim(uint32_t index, uint32_t startDay, uint32_t endDay) {
+    while (!tryClaim(index, startDay, endDay)) {
+        if (!settledFree(index, startDay, endDay)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool AvailabilityGrid::tryClaim(uint32_t index, uint32_t startDay, uint32_t endDay) {
+    std::atomic<uint64_t>* block = blocks[index / BITS].get();
+    std::atomic<uint64_t>& word = claimWord(index);
+    uint64_t bit = bitOf(index);
+    // Announced before any day is touched, so a reader that sees one of
+    // our days taken also sees the claim in flight
+    word.fetch_add(CLAIM_STARTED + 1, std::memory_order_acq_rel);
+    bool claimed = true;
+    for (uint32_t day = startDay; day < endDay; ++day) {
+        if ((block[day].fetch_and(~bit, std::memory_order_acq_rel) & bit) == 0) {
+            // Someone else holds this day: hand back what we took
+            for (uint32_t taken = startDay; taken < day; ++taken) {
+                block[taken].fetch_or(bit, std::memory_order_release);
+            }
+            claimed = false;
+            break;
+        }
+    }
+    word.fetch_sub(1, std::memory_order_release);
+    return claimed;
+}
+
+bool AvailabilityGrid::settledFree(uint32_t index, uint32_t startDay, uint32_t endDay) const {
+    const std::atomic<uint64_t>& word = claimWord(index);
+    while (true) {
+        uint64_t before = word.load(std::memory_order_acquire);
+        if ((before & IN_FLIGHT_MASK) != 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        bool free = isFree(index, startDay, endDay);
+        // Seqlock-style validation: no claim started while the days were read
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (word.load(std::memory_order_relaxed) == before) {
+            return free;
+        }
+    }
+}
+
+void AvailabilityGrid::release(uint32_t index, uint32_t startDay, uint32_t endDay) {
+    std::atomic<uint64_t>* block = blocks[index / BITS].get();
+    uint64_t bit = bitOf(index);
+    for (uint32_t day = startDay; day < endDay; ++day) {
+        block[day].fetch_or(bit, std::memory_order_release);
+    }
+}
+
+} // namespace Calendar
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Calendar {
+
+// Per-day availability for the vehicles of one (branch, class) group.
+//
+// Vehicles are packed 64 to a word: bit i of block b, day d is set when
+// vehicle 64b + i is free on day d. Each block stores its days
+// contiguously, so "free from t1 to t2" is, per block, an AND of
+// (t2 - t1) consecutive words that stops early once no vehicle is left,
+// and a booking touches one contiguous run of words. No reservation
+// lists are consulted.
+//
+// Searches are lock-free snapshots. Booking claims days optimistically:
+// it clears the vehicle's bit day by day in ascending order with
+// fetch_and, and if a day was already taken it restores the days it
+// claimed. Ascending order means two overlapping claims meet on the same
+// first contested day, so one of them wins.
+//
+// A taken day may belong to a claim that is itself about to roll back,
+// so a failed attempt is not yet a conflict. Each vehicle has a claim
+// word: a start sequence in the high half and the number of claims in
+// flight in the low half. A failed claim waits for a snapshot of the
+// range taken while no claim was in flight. If the range is busy in that
+// snapshot, committed bookings hold it and the claim reports a conflict.
+// If it is free, the claim retries.
+//
+// addVehicle() is for fleet set-up and must not run concurrently with
+// anything else.
+class AvailabilityGrid {
+private:
+    static constexpr uint32_t BITS = 64;
+
+    uint32_t days;
+    uint32_t vehicleCount;
+    std::vector<std::unique_ptr<std::atomic<uint64_t>[]>> blocks;
+    std::vector<std::unique_ptr<std::atomic<uint64_t>[]>> claimWords;   // BITS per block
+
+    static constexpr uint64_t CLAIM_STARTED = 1ULL << 32;
+    static constexpr uint64_t IN_FLIGHT_MASK = CLAIM_STARTED - 1;
+
+    static uint64_t bitOf(uint32_t index) { return 1ULL << (index % BITS); }
+    std::atomic<uint64_t>& claimWord(uint32_t index) const { return claimWords[index / BITS][index % BITS]; }
+
+    bool tryClaim(uint32_t index, uint32_t startDay, uint32_t endDay);
+    // Waits until no claim on the vehicle is in flight; true when the
+    // range was then free
+    bool settledFree(uint32_t index, uint32_t startDay, uint32_t endDay) const;
+
+public:
+    explicit AvailabilityGrid(uint32_t days);
+
+    // Adds a vehicle free on every day; returns its column
+    uint32_t addVehicle();
+
+    // Appends the columns of vehicles free on every day in [startDay, endDay),
+    // up to limit; returns how many were appended
+    std::size_t findFree(uint32_t startDay, uint32_t endDay, std::vector<uint32_t>& out, std::size_t limit) const;
+    bool isFree(uint32_t index, uint32_t startDay, uint32_t endDay) const;
+
+    // Takes every day in the range or none of them; false only when a
+    // committed booking holds one of the days
+    bool claim(uint32_t index, uint32_t startDay, uint32_t endDay);
+    void release(uint32_t index, uint32_t startDay, uint32_t endDay);
+
+    // Getters
+    uint32_t getDays() const { return days; }
+    uint32_t getVehicleCount() const { return vehicleCount; }
+};
+
+} // namespace Calendar
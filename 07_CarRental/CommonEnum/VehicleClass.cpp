@@ -0,0 +1,43 @@
+#include "VehicleClass.hpp"
+
+namespace CommonEnum {
+
+const char* vehicleClassToString(VehicleClass vehicleClass) {
+    switch (vehicleClass) {
+        case VehicleClass::ECONOMY:
+            return "ECONOMY";
+        case VehicleClass::COMPACT:
+            return "COMPACT";
+        case VehicleClass::SEDAN:
+            return "SEDAN";
+        case VehicleClass::SUV:
+            return "SUV";
+        case VehicleClass::LUXURY:
+            return "LUXURY";
+        case VehicleClass::VAN:
+            return "VAN";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+const char* bookingStatusToString(BookingStatus status) {
+    switch (status) {
+        case BookingStatus::SUCCESS:
+            return "SUCCESS";
+        case BookingStatus::UNKNOWN_VEHICLE:
+            return "UNKNOWN_VEHICLE";
+        case BookingStatus::UNKNOWN_BOOKING:
+            return "UNKNOWN_BOOKING";
+        case BookingStatus::INVALID_RANGE:
+            return "INVALID_RANGE";
+        case BookingStatus::CONFLICT:
+            return "CONFLICT";
+        case BookingStatus::NOT_AVAILABLE:
+            return "NOT_AVAILABLE";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+} // namespace CommonEnum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CommonEnum {
+
+enum class VehicleClass : uint8_t {
+    ECONOMY,
+    COMPACT,
+    SEDAN,
+    SUV,
+    LUXURY,
+    VAN
+};
+
+enum class BookingStatus {
+    SUCCESS,
+    UNKNOWN_VEHICLE,
+    UNKNOWN_BOOKING,
+    INVALID_RANGE,
+    CONFLICT,           // another booking claimed one of the days first
+    NOT_AVAILABLE       // no vehicle of the class is free for the range
+};
+
+constexpr int VEHICLE_CLASS_COUNT = 6;
+
+// Utility functions for rental enums
+const char* vehicleClassToString(VehicleClass vehicleClass);
+const char* bookingStatusToString(BookingStatus status);
+
+} // namespace CommonEnum
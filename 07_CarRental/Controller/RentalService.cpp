@@ -0,0 +1,121 @@
+#include "RentalService.hpp"
+
+namespace Controller {
+
+RentalService::RentalService(uint32_t horizonDays) : horizonDays(horizonDays), conflicts(0) {}
+
+uint32_t RentalService::addVehicle(const std::string& plate, uint32_t branch, CommonEnum::VehicleClass vehicleClass) {
+    auto found = groupIndex.emplace(groupKey(branch, vehicleClass), static_cast<uint32_t>(groups.size()));
+    if (found.second) {
+        groups.push_back(std::make_unique<Group>(horizonDays));
+    }
+    uint32_t groupId = found.first->second;
+    Group& group = *groups[groupId];
+    uint32_t id = static_cast<uint32_t>(vehicles.size());
+    uint32_t column = group.grid.addVehicle();
+    group.vehicles.push_back(id);
+    vehicles.push_back(Utility::Vehicle{id, plate, branch, vehicleClass, groupId, column});
+    return id;
+}
+
+RentalService::Group* RentalService::findGroup(uint32_t branch, CommonEnum::VehicleClass vehicleClass) const {
+    auto found = groupIndex.find(groupKey(branch, vehicleClass));
+    return found == groupIndex.end() ? nullptr : groups[found->second].get();
+}
+
+std::size_t RentalService::searchAvailable(uint32_t branch, CommonEnum::VehicleClass vehicleClass, uint32_t startDay,
+                                           uint32_t endDay, std::vector<uint32_t>& vehicleIds, std::size_t limit) const {
+    const Group* group = findGroup(branch, vehicleClass);
+    if (group == nullptr || !validRange(startDay, endDay)) {
+        return 0;
+    }
+    std::size_t first = vehicleIds.size();
+    std::size_t found = group->grid.findFree(startDay, endDay, vehicleIds, limit);
+    for (std::size_t i = first; i < vehicleIds.size(); ++i) {
+        vehicleIds[i] = group->vehicles[vehicleIds[i]];
+    }
+    return found;
+}
+
+bool RentalService::isAvailable(uint32_t vehicleId, uint32_t startDay, uint32_t endDay) const {
+    if (vehicleId >= vehicles.size() || !validRange(startDay, endDay)) {
+        return false;
+    }
+    const Utility::Vehicle& vehicle = vehicles[vehicleId];
+    return groups[vehicle.group]->grid.isFree(vehicle.index, startDay, endDay);
+}
+
+uint64_t RentalService::recordBooking(uint32_t vehicle, uint32_t startDay, uint32_t endDay) {
+    std::lock_guard<std::mutex> lock(bookingMutex);
+    uint64_t id = bookings.size();
+    bookings.push_back(Utility::Booking{id, vehicle, startDay, endDay, true});
+    return id;
+}
+
+CommonEnum::BookingStatus RentalService::book(uint32_t vehicleId, uint32_t startDay, uint32_t endDay,
+                                              uint64_t& bookingId) {
+    if (vehicleId >= vehicles.size()) {
+        return CommonEnum::BookingStatus::UNKNOWN_VEHICLE;
+    }
+    if (!validRange(startDay, endDay)) {
+        return CommonEnum::BookingStatus::INVALID_RANGE;
+    }
+    const Utility::Vehicle& vehicle = vehicles[vehicleId];
+    if (!groups[vehicle.group]->grid.claim(vehicle.index, startDay, endDay)) {
+        conflicts.fetch_add(1, std::memory_order_relaxed);
+        return CommonEnum::BookingStatus::CONFLICT;
+    }
+    bookingId = recordBooking(vehicleId, startDay, endDay);
+    return CommonEnum::BookingStatus::SUCCESS;
+}
+
+CommonEnum::BookingStatus RentalService::bookAny(uint32_t branch, CommonEnum::VehicleClass vehicleClass,
+                                                 uint32_t startDay, uint32_t endDay, uint64_t& bookingId,
+                                                 uint32_t& vehicleId) {
+    if (!validRange(startDay, endDay)) {
+        return CommonEnum::BookingStatus::INVALID_RANGE;
+    }
+    Group* group = findGroup(branch, vehicleClass);
+    if (group == nullptr) {
+        return CommonEnum::BookingStatus::NOT_AVAILABLE;
+    }
+    // Fetch a few candidates at a time; losing a race just moves on to the next
+    std::vector<uint32_t> candidates;
+    constexpr std::size_t CANDIDATES = 8;
+    while (true) {
+        candidates.clear();
+        if (group->grid.findFree(startDay, endDay, candidates, CANDIDATES) == 0) {
+            return CommonEnum::BookingStatus::NOT_AVAILABLE;
+        }
+        for (uint32_t column : candidates) {
+            if (group->grid.claim(column, startDay, endDay)) {
+                vehicleId = group->vehicles[column];
+                bookingId = recordBooking(vehicleId, startDay, endDay);
+                return CommonEnum::BookingStatus::SUCCESS;
+            }
+            conflicts.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+CommonEnum::BookingStatus RentalService::cancel(uint64_t bookingId) {
+    Utility::Booking booking;
+    {
+        std::lock_guard<std::mutex> lock(bookingMutex);
+        if (bookingId >= bookings.size() || !bookings[bookingId].active) {
+            return CommonEnum::BookingStatus::UNKNOWN_BOOKING;
+        }
+        bookings[bookingId].active = false;
+        booking = bookings[bookingId];
+    }
+    const Utility::Vehicle& vehicle = vehicles[booking.vehicle];
+    groups[vehicle.group]->grid.release(vehicle.index, booking.startDay, booking.endDay);
+    return CommonEnum::BookingStatus::SUCCESS;
+}
+
+std::vector<Utility::Booking> RentalService::getBookings() {
+    std::lock_guard<std::mutex> lock(bookingMutex);
+    return bookings;
+}
+
+} // namespace Controller
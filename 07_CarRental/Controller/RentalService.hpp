@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Calendar/AvailabilityGrid.hpp"
+#include "CommonEnum/VehicleClass.hpp"
+#include "Utility/Vehicle.hpp"
+
+namespace Controller {
+
+// Fleet, availability and bookings. Each (branch, class) pair has its own
+// availability grid, so a search only scans the vehicles it could return.
+// Searches and bookings are safe to run concurrently; adding vehicles is
+// set-up work and must finish before either starts.
+class RentalService {
+private:
+    struct Group {
+        Calendar::AvailabilityGrid grid;
+        std::vector<uint32_t> vehicles;   // column -> vehicle id
+
+        explicit Group(uint32_t days) : grid(days) {}
+    };
+
+    uint32_t horizonDays;
+    std::vector<Utility::Vehicle> vehicles;
+    std::unordered_map<uint64_t, uint32_t> groupIndex;   // (branch, class) -> group
+    std::vector<std::unique_ptr<Group>> groups;
+
+    std::mutex bookingMutex;
+    std::vector<Utility::Booking> bookings;              // by id
+    std::atomic<uint64_t> conflicts;
+
+    static uint64_t groupKey(uint32_t branch, CommonEnum::VehicleClass vehicleClass) {
+        return (static_cast<uint64_t>(branch) << 8) | static_cast<uint8_t>(vehicleClass);
+    }
+    Group* findGroup(uint32_t branch, CommonEnum::VehicleClass vehicleClass) const;
+    bool validRange(uint32_t startDay, uint32_t endDay) const {
+        return startDay < endDay && endDay <= horizonDays;
+    }
+    uint64_t recordBooking(uint32_t vehicle, uint32_t startDay, uint32_t endDay);
+
+public:
+    explicit RentalService(uint32_t horizonDays = 366);
+
+    uint32_t addVehicle(const std::string& plate, uint32_t branch, CommonEnum::VehicleClass vehicleClass);
+
+    // Vehicle ids of the class at the branch free on every day in
+    // [startDay, endDay), up to limit. A snapshot: a later book() is the
+    // authoritative check.
+    std::size_t searchAvailable(uint32_t branch, CommonEnum::VehicleClass vehicleClass, uint32_t startDay,
+                                uint32_t endDay, std::vector<uint32_t>& vehicleIds,
+                                std::size_t limit = SIZE_MAX) const;
+
+    bool isAvailable(uint32_t vehicleId, uint32_t startDay, uint32_t endDay) const;
+
+    CommonEnum::BookingStatus book(uint32_t vehicleId, uint32_t startDay, uint32_t endDay, uint64_t& bookingId);
+    // Books any free vehicle of the class, moving on to the next candidate
+    // when another booking wins the race for one
+    CommonEnum::BookingStatus bookAny(uint32_t branch, CommonEnum::VehicleClass vehicleClass, uint32_t startDay,
+                                      uint32_t endDay, uint64_t& bookingId, uint32_t& vehicleId);
+    CommonEnum::BookingStatus cancel(uint64_t bookingId);
+
+    // Getters
+    uint32_t getHorizonDays() const { return horizonDays; }
+    std::size_t getVehicleCount() const { return vehicles.size(); }
+    std::size_t getGroupCount() const { return groups.size(); }
+    const Utility::Vehicle& getVehicle(uint32_t vehicleId) const { return vehicles.at(vehicleId); }
+    uint64_t getConflicts() const { return conflicts.load(std::memory_order_relaxed); }
+    std::vector<Utility::Booking> getBookings();
+};
+
+} // namespace Controller
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "CommonEnum/VehicleClass.hpp"
+
+namespace Utility {
+
+struct Vehicle {
+    uint32_t id;
+    std::string plate;
+    uint32_t branch;
+    CommonEnum::VehicleClass vehicleClass;
+    uint32_t group;     // (branch, class) availability grid
+    uint32_t index;     // column within that grid
+};
+
+// Days are counted from the start of the calendar; ranges are [start, end)
+struct Booking {
+    uint64_t id;
+    uint32_t vehicle;
+    uint32_t startDay;
+    uint32_t endDay;
+    bool active;
+};
+
+} // namespace Utility
@@ -0,0 +1,67 @@
+#include "Controller/RentalService.hpp"
+#include "Benchmark/SearchBenchmark.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+int main(int argc, char* argv[]) {
+    std::cout << "Car Rental System Implementation" << std::endl;
+
+    Controller::RentalService rental(30);
+    uint32_t golf = rental.addVehicle("KA-01-1111", 0, CommonEnum::VehicleClass::COMPACT);
+    uint32_t polo = rental.addVehicle("KA-01-2222", 0, CommonEnum::VehicleClass::COMPACT);
+    rental.addVehicle("KA-01-3333", 0, CommonEnum::VehicleClass::SUV);
+
+    uint64_t booking;
+    std::cout << "Book golf days 3-7: "
+              << CommonEnum::bookingStatusToString(rental.book(golf, 3, 7, booking)) << std::endl;
+    uint64_t overlapping;
+    std::cout << "Book golf days 6-9: "
+              << CommonEnum::bookingStatusToString(rental.book(golf, 6, 9, overlapping)) << std::endl;
+    std::vector<uint32_t> free;
+    rental.searchAvailable(0, CommonEnum::VehicleClass::COMPACT, 5, 8, free);
+    std::cout << "Compacts free days 5-8:";
+    for (uint32_t id : free) {
+        std::cout << " " << rental.getVehicle(id).plate;
+    }
+    std::cout << std::endl;
+    uint64_t second;
+    uint32_t assigned;
+    rental.book(polo, 0, 30, second);
+    std::cout << "Any compact days 5-8: "
+              << CommonEnum::bookingStatusToString(rental.bookAny(0, CommonEnum::VehicleClass::COMPACT, 5, 8, second, assigned))
+              << std::endl;
+    rental.cancel(booking);
+    std::cout << "After cancel, any compact days 5-8: "
+              << CommonEnum::bookingStatusToString(rental.bookAny(0, CommonEnum::VehicleClass::COMPACT, 5, 8, second, assigned))
+              << " (" << rental.getVehicle(assigned).plate << ")" << std::endl;
+
+    // 100k vehicles over a one-year calendar
+    uint32_t vehicles = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 100000;
+    uint32_t branches = 50;
+    Controller::RentalService fleet(366);
+    Benchmark::buildFleet(fleet, vehicles, branches);
+    Benchmark::ReservationLists baseline(fleet, branches);
+    std::mt19937_64 rng(11);
+    double occupancy = Benchmark::prefillBookings(fleet, baseline, rng);
+    std::printf("\n%u vehicles in %zu (branch, class) groups, %.0f%% of vehicle-days booked\n", vehicles,
+                fleet.getGroupCount(), occupancy * 100);
+
+    for (const auto& result : Benchmark::runQueryBenchmark(fleet, baseline, branches, 200000, 5)) {
+        std::printf("  %-18s p50 %7.0f ns  p99 %7.0f ns  mean %7.0f ns  (%.2fM queries/s, %llu matches)\n", result.name,
+                    result.p50Nanos, result.p99Nanos, result.meanNanos, 1e3 / result.meanNanos,
+                    static_cast<unsigned long long>(result.matches));
+    }
+
+    for (int threads : {1, 4, 8}) {
+        Benchmark::BookingResult result = Benchmark::runConcurrentBooking(fleet, branches, threads, 200000, 100 + threads);
+        std::printf("  %d threads: %.2fM ops/s  %llu booked, %llu cancelled, %llu not available, %llu lost races\n",
+                    threads, (result.searches + result.bookings + result.notAvailable + result.cancels) / result.seconds / 1e6,
+                    static_cast<unsigned long long>(result.bookings), static_cast<unsigned long long>(result.cancels),
+                    static_cast<unsigned long long>(result.notAvailable), static_cast<unsigned long long>(result.conflicts));
+    }
+    std::cout << "Calendar consistent with bookings: " << (Benchmark::verifyCalendar(fleet) ? "yes" : "no") << std::endl;
+    std::cout << "Racing overlapping bookings refused only by a winner: "
+              << (Benchmark::verifyConcurrentClaims(4, 2000) ? "yes" : "no") << std::endl;
+    return 0;
+}
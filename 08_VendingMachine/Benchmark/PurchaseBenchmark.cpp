@@ -0,0 +1,62 @@
+#include "PurchaseBenchmark.hpp"
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace Benchmark {
+
+PurchaseBenchmarkResult runPurchaseBenchmark(Controller::VendingFleet& fleet, int threads,
+                                             uint64_t attemptsPerThread) {
+    std::atomic<uint64_t> purchases{0}, busy{0}, soldOut{0}, otherFailures{0};
+    std::atomic<bool> start{false};
+    std::size_t machineCount = fleet.getMachineCount();
+    std::size_t slots = fleet.getInventory().getSlotsPerMachine();
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            std::mt19937_64 rng(t + 1);
+            uint64_t localPurchases = 0, localBusy = 0, localSoldOut = 0, localOther = 0;
+            CommonEnum::CoinCounts dollar{};
+            dollar[CommonEnum::coinIndex(CommonEnum::Coin::DOLLAR)] = 1;
+
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (uint64_t i = 0; i < attemptsPerThread; i++) {
+                uint64_t roll = rng();
+                auto result = fleet.purchase(roll % machineCount, (roll >> 32) % slots, dollar);
+                switch (result.status) {
+                    case CommonEnum::PurchaseStatus::SUCCESS: localPurchases++; break;
+                    case CommonEnum::PurchaseStatus::MACHINE_BUSY: localBusy++; break;
+                    case CommonEnum::PurchaseStatus::SOLD_OUT: localSoldOut++; break;
+                    default: localOther++; break;
+                }
+            }
+            purchases += localPurchases;
+            busy += localBusy;
+            soldOut += localSoldOut;
+            otherFailures += localOther;
+        });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    PurchaseBenchmarkResult result;
+    result.attempts = attemptsPerThread * threads;
+    result.purchases = purchases.load();
+    result.busy = busy.load();
+    result.soldOut = soldOut.load();
+    result.otherFailures = otherFailures.load();
+    result.seconds = std::chrono::duration<double>(end - begin).count();
+    return result;
+}
+
+} // namespace Benchmark
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include "Controller/VendingFleet.hpp"
+
+namespace Benchmark {
+
+struct PurchaseBenchmarkResult {
+    uint64_t attempts = 0;
+    uint64_t purchases = 0;
+    uint64_t busy = 0;
+    uint64_t soldOut = 0;
+    uint64_t otherFailures = 0;
+    double seconds = 0.0;
+
+    double purchasesPerSecond() const { return seconds > 0 ? purchases / seconds : 0.0; }
+};
+
+// Hammers random machines and slots of the fleet from `threads` threads
+PurchaseBenchmarkResult runPurchaseBenchmark(Controller::VendingFleet& fleet, int threads,
+                                             uint64_t attemptsPerThread);
+
+} // namespace Benchmark
@@ -0,0 +1,43 @@
+#include "Coin.hpp"
+
+namespace CommonEnum {
+
+const char* coinToString(Coin coin) {
+    switch (coin) {
+        case Coin::NICKEL:
+            return "NICKEL";
+        case Coin::DIME:
+            return "DIME";
+        case Coin::QUARTER:
+            return "QUARTER";
+        case Coin::DOLLAR:
+            return "DOLLAR";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+uint32_t coinValue(Coin coin) {
+    switch (coin) {
+        case Coin::NICKEL:
+            return 5;
+        case Coin::DIME:
+            return 10;
+        case Coin::QUARTER:
+            return 25;
+        case Coin::DOLLAR:
+            return 100;
+        default:
+            return 0;
+    }
+}
+
+uint32_t totalValue(const CoinCounts& counts) {
+    uint32_t total = 0;
+    for (std::size_t i = 0; i < COIN_COUNT; i++) {
+        total += counts[i] * coinValue(static_cast<Coin>(i));
+    }
+    return total;
+}
+
+} // namespace CommonEnum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace CommonEnum {
+
+enum class Coin {
+    NICKEL,
+    DIME,
+    QUARTER,
+    DOLLAR
+};
+
+constexpr std::size_t COIN_COUNT = 4;
+
+// Per-denomination coin counts, indexed by coinIndex()
+using CoinCounts = std::array<uint32_t, COIN_COUNT>;
+
+// Utility functions for Coin enum
+const char* coinToString(Coin coin);
+uint32_t coinValue(Coin coin);  // in cents
+inline std::size_t coinIndex(Coin coin) { return static_cast<std::size_t>(coin); }
+uint32_t totalValue(const CoinCounts& counts);
+
+} // namespace CommonEnum
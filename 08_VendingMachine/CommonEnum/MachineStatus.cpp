@@ -0,0 +1,39 @@
+#include "MachineStatus.hpp"
+
+namespace CommonEnum {
+
+const char* machineStatusToString(MachineStatus status) {
+    switch (status) {
+        case MachineStatus::IDLE:
+            return "IDLE";
+        case MachineStatus::HAS_MONEY:
+            return "HAS_MONEY";
+        case MachineStatus::DISPENSING:
+            return "DISPENSING";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+const char* purchaseStatusToString(PurchaseStatus status) {
+    switch (status) {
+        case PurchaseStatus::SUCCESS:
+            return "SUCCESS";
+        case PurchaseStatus::MACHINE_BUSY:
+            return "MACHINE_BUSY";
+        case PurchaseStatus::INVALID_SLOT:
+            return "INVALID_SLOT";
+        case PurchaseStatus::INSUFFICIENT_FUNDS:
+            return "INSUFFICIENT_FUNDS";
+        case PurchaseStatus::SOLD_OUT:
+            return "SOLD_OUT";
+        case PurchaseStatus::NO_CHANGE:
+            return "NO_CHANGE";
+        case PurchaseStatus::INVALID_STATE:
+            return "INVALID_STATE";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+} // namespace CommonEnum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CommonEnum {
+
+enum class MachineStatus : uint8_t {
+    IDLE,
+    HAS_MONEY,
+    DISPENSING
+};
+
+enum class PurchaseStatus {
+    SUCCESS,
+    MACHINE_BUSY,
+    INVALID_SLOT,
+    INSUFFICIENT_FUNDS,
+    SOLD_OUT,
+    NO_CHANGE,
+    INVALID_STATE
+};
+
+// Utility functions for status enums
+const char* machineStatusToString(MachineStatus status);
+const char* purchaseStatusToString(PurchaseStatus status);
+
+} // namespace CommonEnum
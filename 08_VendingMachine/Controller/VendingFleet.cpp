@@ -0,0 +1,77 @@
+#include "VendingFleet.hpp"
+
+namespace Controller {
+
+namespace {
+
+// Same answer purchase() gives: the machine index is as unknown as a bad slot
+Utility::PurchaseResult unknownMachine(const CommonEnum::CoinCounts& returned = {}) {
+    Utility::PurchaseResult result;
+    result.status = CommonEnum::PurchaseStatus::INVALID_SLOT;
+    result.returned = returned;
+    return result;
+}
+
+}
+
+VendingFleet::VendingFleet(std::size_t machineCount, std::size_t slotsPerMachine, uint32_t maxChange)
+    : inventory(machineCount, slotsPerMachine), coinBox(machineCount), changeMaker(maxChange),
+      resources{inventory, coinBox, changeMaker}, machines(new StateHandler::Context::MachineContext[machineCount]) {
+    for (std::size_t i = 0; i < machineCount; i++) {
+        machines[i].attach(i, resources);
+    }
+}
+
+Utility::PurchaseResult VendingFleet::insertMoney(std::size_t machine, const CommonEnum::CoinCounts& coins) {
+    if (machine >= getMachineCount()) {
+        return unknownMachine(coins);
+    }
+    auto& context = machines[machine];
+    return context.getState().insertMoney(context, coins);
+}
+
+Utility::PurchaseResult VendingFleet::selectProduct(std::size_t machine, std::size_t slot) {
+    if (machine >= getMachineCount()) {
+        return unknownMachine();
+    }
+    auto& context = machines[machine];
+    return context.getState().selectProduct(context, slot);
+}
+
+Utility::PurchaseResult VendingFleet::dispense(std::size_t machine) {
+    if (machine >= getMachineCount()) {
+        return unknownMachine();
+    }
+    auto& context = machines[machine];
+    return context.getState().dispense(context);
+}
+
+Utility::PurchaseResult VendingFleet::cancel(std::size_t machine) {
+    if (machine >= getMachineCount()) {
+        return unknownMachine();
+    }
+    auto& context = machines[machine];
+    return context.getState().cancel(context);
+}
+
+Utility::PurchaseResult VendingFleet::purchase(std::size_t machine, std::size_t slot,
+                                               const CommonEnum::CoinCounts& coins) {
+    if (machine >= getMachineCount()) {
+        return unknownMachine(coins);
+    }
+    // Always enter through IDLE: its CAS makes this call the session owner,
+    // so a concurrent purchase can never add coins to someone else's session
+    auto& context = machines[machine];
+    auto inserted = StateHandler::VendingState::forStatus(CommonEnum::MachineStatus::IDLE).insertMoney(context, coins);
+    if (!inserted.isSuccess()) {
+        return inserted;
+    }
+    auto selected = selectProduct(machine, slot);
+    if (!selected.isSuccess()) {
+        selected.returned = cancel(machine).returned;
+        return selected;
+    }
+    return dispense(machine);
+}
+
+} // namespace Controller
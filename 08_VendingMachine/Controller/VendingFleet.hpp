@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include "CommonEnum/Coin.hpp"
+#include "Utility/Inventory.hpp"
+#include "Utility/CoinBox.hpp"
+#include "Utility/ChangeMaker.hpp"
+#include "Utility/PurchaseResult.hpp"
+#include "StateHandler/Context/MachineContext.hpp"
+
+namespace Controller {
+
+// Backend for a fleet of machines served from one process. Each call is
+// routed to the machine's current state object.
+class VendingFleet {
+private:
+    Utility::Inventory inventory;
+    Utility::CoinBox coinBox;
+    Utility::ChangeMaker changeMaker;
+    StateHandler::Context::FleetResources resources;
+    std::unique_ptr<StateHandler::Context::MachineContext[]> machines;
+
+public:
+    VendingFleet(std::size_t machineCount, std::size_t slotsPerMachine, uint32_t maxChange = 1000);
+
+    // Single steps of a session, as driven by a machine's own front panel;
+    // remote callers should use purchase(), which claims the machine first.
+    // An unknown machine index is INVALID_SLOT here as in purchase().
+    Utility::PurchaseResult insertMoney(std::size_t machine, const CommonEnum::CoinCounts& coins);
+    Utility::PurchaseResult selectProduct(std::size_t machine, std::size_t slot);
+    Utility::PurchaseResult dispense(std::size_t machine);
+    Utility::PurchaseResult cancel(std::size_t machine);
+
+    // Whole session: pay, select, dispense; refunds the payment on any failure
+    Utility::PurchaseResult purchase(std::size_t machine, std::size_t slot, const CommonEnum::CoinCounts& coins);
+
+    // Getters
+    Utility::Inventory& getInventory() { return inventory; }
+    Utility::CoinBox& getCoinBox() { return coinBox; }
+    std::size_t getMachineCount() const { return inventory.getMachineCount(); }
+    CommonEnum::MachineStatus getStatus(std::size_t machine) const { return machines[machine].getStatus(); }
+};
+
+} // namespace Controller
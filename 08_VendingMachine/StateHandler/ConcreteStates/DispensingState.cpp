@@ -0,0 +1,17 @@
+#include "DispensingState.hpp"
+#include "StateHandler/Context/MachineContext.hpp"
+
+namespace StateHandler {
+namespace ConcreteStates {
+
+Utility::PurchaseResult DispensingState::dispense(Context::MachineContext& context) const {
+    Utility::PurchaseResult result;
+    result.status = CommonEnum::PurchaseStatus::SUCCESS;
+    result.returned = context.getChange();
+    context.getChange() = {};
+    context.transition(CommonEnum::MachineStatus::DISPENSING, CommonEnum::MachineStatus::IDLE);
+    return result;
+}
+
+} // namespace ConcreteStates
+} // namespace StateHandler
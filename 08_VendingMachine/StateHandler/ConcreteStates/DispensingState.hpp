@@ -0,0 +1,15 @@
+#pragma once
+
+#include "StateHandler/VendingState.hpp"
+
+namespace StateHandler {
+namespace ConcreteStates {
+
+class DispensingState : public VendingState {
+public:
+    CommonEnum::MachineStatus getStatus() const override { return CommonEnum::MachineStatus::DISPENSING; }
+    Utility::PurchaseResult dispense(Context::MachineContext& context) const override;
+};
+
+} // namespace ConcreteStates
+} // namespace StateHandler
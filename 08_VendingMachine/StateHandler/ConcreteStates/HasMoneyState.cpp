@@ -0,0 +1,108 @@
+#include "HasMoneyState.hpp"
+#include "StateHandler/Context/MachineContext.hpp"
+
+namespace StateHandler {
+namespace ConcreteStates {
+
+using CommonEnum::PurchaseStatus;
+
+namespace {
+
+// Inserted coins can be paid out as change, so the hopper only has to
+// cover what the plan needs beyond them. Taking that shortfall first
+// (all or nothing) and banking the surplus after means a failure leaves
+// both the hopper and the escrow untouched.
+bool payOut(Utility::CoinBox& coinBox, std::size_t machine, const CommonEnum::CoinCounts& escrow,
+            const CommonEnum::CoinCounts& plan) {
+    CommonEnum::CoinCounts shortfall{};
+    CommonEnum::CoinCounts surplus{};
+    for (std::size_t coin = 0; coin < CommonEnum::COIN_COUNT; coin++) {
+        if (plan[coin] > escrow[coin]) {
+            shortfall[coin] = plan[coin] - escrow[coin];
+        } else {
+            surplus[coin] = escrow[coin] - plan[coin];
+        }
+    }
+    if (!coinBox.tryWithdraw(machine, shortfall)) {
+        return false;
+    }
+    coinBox.deposit(machine, surplus);
+    return true;
+}
+
+}
+
+Utility::PurchaseResult HasMoneyState::insertMoney(Context::MachineContext& context,
+                                                   const CommonEnum::CoinCounts& coins) const {
+    for (std::size_t coin = 0; coin < CommonEnum::COIN_COUNT; coin++) {
+        context.getEscrow()[coin] += coins[coin];
+    }
+    Utility::PurchaseResult result;
+    result.status = PurchaseStatus::SUCCESS;
+    return result;
+}
+
+Utility::PurchaseResult HasMoneyState::selectProduct(Context::MachineContext& context, std::size_t slot) const {
+    Utility::PurchaseResult result;
+    auto& resources = context.getResources();
+    std::size_t machine = context.getMachineId();
+
+    // Failures leave the machine in HAS_MONEY so the buyer can pick again or cancel
+    if (!resources.inventory.isValid(machine, slot)) {
+        result.status = PurchaseStatus::INVALID_SLOT;
+        return result;
+    }
+    uint32_t price = resources.inventory.getPrice(machine, slot);
+    uint32_t credit = CommonEnum::totalValue(context.getEscrow());
+    if (credit < price) {
+        result.status = PurchaseStatus::INSUFFICIENT_FUNDS;
+        return result;
+    }
+    uint32_t change = credit - price;
+    auto plan = resources.changeMaker.makeChange(change);
+    if (!plan) {
+        result.status = PurchaseStatus::NO_CHANGE;
+        return result;
+    }
+    if (!resources.inventory.tryTake(machine, slot)) {
+        result.status = PurchaseStatus::SOLD_OUT;
+        return result;
+    }
+
+    bool paid = payOut(resources.coinBox, machine, context.getEscrow(), *plan);
+    if (!paid) {
+        // The optimal plan needs coins the hopper lacks: settle for any plan
+        // the hopper and the inserted coins can cover
+        CommonEnum::CoinCounts available = context.getEscrow();
+        for (std::size_t coin = 0; coin < CommonEnum::COIN_COUNT; coin++) {
+            available[coin] += resources.coinBox.getCount(machine, static_cast<CommonEnum::Coin>(coin));
+        }
+        plan = resources.changeMaker.makeChange(change, available);
+        paid = plan && payOut(resources.coinBox, machine, context.getEscrow(), *plan);
+    }
+    if (!paid) {
+        resources.inventory.restock(machine, slot, 1);
+        result.status = PurchaseStatus::NO_CHANGE;
+        return result;
+    }
+
+    context.getEscrow() = {};
+    context.getChange() = *plan;
+    context.setSelectedSlot(slot);
+    context.transition(CommonEnum::MachineStatus::HAS_MONEY, CommonEnum::MachineStatus::DISPENSING);
+    result.status = PurchaseStatus::SUCCESS;
+    result.returned = *plan;
+    return result;
+}
+
+Utility::PurchaseResult HasMoneyState::cancel(Context::MachineContext& context) const {
+    Utility::PurchaseResult result;
+    result.status = PurchaseStatus::SUCCESS;
+    result.returned = context.getEscrow();
+    context.getEscrow() = {};
+    context.transition(CommonEnum::MachineStatus::HAS_MONEY, CommonEnum::MachineStatus::IDLE);
+    return result;
+}
+
+} // namespace ConcreteStates
+} // namespace StateHandler
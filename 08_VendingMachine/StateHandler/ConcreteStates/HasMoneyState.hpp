@@ -0,0 +1,18 @@
+#pragma once
+
+#include "StateHandler/VendingState.hpp"
+
+namespace StateHandler {
+namespace ConcreteStates {
+
+class HasMoneyState : public VendingState {
+public:
+    CommonEnum::MachineStatus getStatus() const override { return CommonEnum::MachineStatus::HAS_MONEY; }
+    Utility::PurchaseResult insertMoney(Context::MachineContext& context,
+                                        const CommonEnum::CoinCounts& coins) const override;
+    Utility::PurchaseResult selectProduct(Context::MachineContext& context, std::size_t slot) const override;
+    Utility::PurchaseResult cancel(Context::MachineContext& context) const override;
+};
+
+} // namespace ConcreteStates
+} // namespace StateHandler
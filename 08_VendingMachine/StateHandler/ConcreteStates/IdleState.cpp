@@ -0,0 +1,23 @@
+#include "IdleState.hpp"
+#include "StateHandler/Context/MachineContext.hpp"
+
+namespace StateHandler {
+namespace ConcreteStates {
+
+Utility::PurchaseResult IdleState::insertMoney(Context::MachineContext& context,
+                                               const CommonEnum::CoinCounts& coins) const {
+    Utility::PurchaseResult result;
+    // Losing this CAS means another session got the machine first
+    if (!context.transition(CommonEnum::MachineStatus::IDLE, CommonEnum::MachineStatus::HAS_MONEY)) {
+        result.status = CommonEnum::PurchaseStatus::MACHINE_BUSY;
+        result.returned = coins;
+        return result;
+    }
+    context.getEscrow() = coins;
+    context.getChange() = {};
+    result.status = CommonEnum::PurchaseStatus::SUCCESS;
+    return result;
+}
+
+} // namespace ConcreteStates
+} // namespace StateHandler
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "StateHandler/VendingState.hpp"
+
+namespace StateHandler {
+namespace ConcreteStates {
+
+class IdleState : public VendingState {
+public:
+    CommonEnum::MachineStatus getStatus() const override { return CommonEnum::MachineStatus::IDLE; }
+    Utility::PurchaseResult insertMoney(Context::MachineContext& context,
+                                        const CommonEnum::CoinCounts& coins) const override;
+};
+
+} // namespace ConcreteStates
+} // namespace StateHandler
@@ -0,0 +1,19 @@
+#include "MachineContext.hpp"
+
+namespace StateHandler {
+namespace Context {
+
+MachineContext::MachineContext()
+    : machineId(0), resources(nullptr), status(CommonEnum::MachineStatus::IDLE), escrow{}, change{}, selectedSlot(0) {}
+
+void MachineContext::attach(std::size_t id, FleetResources& fleet) {
+    machineId = id;
+    resources = &fleet;
+}
+
+bool MachineContext::transition(CommonEnum::MachineStatus from, CommonEnum::MachineStatus to) {
+    return status.compare_exchange_strong(from, to, std::memory_order_acq_rel, std::memory_order_acquire);
+}
+
+} // namespace Context
+} // namespace StateHandler
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "CommonEnum/Coin.hpp"
+#include "CommonEnum/MachineStatus.hpp"
+#include "Utility/Inventory.hpp"
+#include "Utility/CoinBox.hpp"
+#include "Utility/ChangeMaker.hpp"
+#include "StateHandler/VendingState.hpp"
+
+namespace StateHandler {
+namespace Context {
+
+// Fleet-wide tables every machine context works against
+struct FleetResources {
+    Utility::Inventory& inventory;
+    Utility::CoinBox& coinBox;
+    const Utility::ChangeMaker& changeMaker;
+};
+
+// Per-machine state. The status is the only shared field: a session
+// starts by moving it out of IDLE with a CAS, and only that caller touches
+// the session fields until the machine is back in IDLE.
+class alignas(64) MachineContext {
+private:
+    std::size_t machineId;
+    FleetResources* resources;
+    std::atomic<CommonEnum::MachineStatus> status;
+    CommonEnum::CoinCounts escrow;  // coins inserted in the current session
+    CommonEnum::CoinCounts change;  // change reserved for the pending dispense
+    std::size_t selectedSlot;
+
+public:
+    MachineContext();
+
+    void attach(std::size_t id, FleetResources& fleet);
+    bool transition(CommonEnum::MachineStatus from, CommonEnum::MachineStatus to);
+    const VendingState& getState() const { return VendingState::forStatus(getStatus()); }
+
+    // Getters
+    std::size_t getMachineId() const { return machineId; }
+    FleetResources& getResources() const { return *resources; }
+    CommonEnum::MachineStatus getStatus() const { return status.load(std::memory_order_acquire); }
+    CommonEnum::CoinCounts& getEscrow() { return escrow; }
+    CommonEnum::CoinCounts& getChange() { return change; }
+    std::size_t getSelectedSlot() const { return selectedSlot; }
+
+    void setSelectedSlot(std::size_t slot) { selectedSlot = slot; }
+};
+
+} // namespace Context
+} // namespace StateHandler
@@ -0,0 +1,47 @@
+#include "VendingState.hpp"
+#include "StateHandler/ConcreteStates/IdleState.hpp"
+#include "StateHandler/ConcreteStates/HasMoneyState.hpp"
+#include "StateHandler/ConcreteStates/DispensingState.hpp"
+
+namespace StateHandler {
+
+namespace {
+Utility::PurchaseResult invalidState() {
+    Utility::PurchaseResult result;
+    result.status = CommonEnum::PurchaseStatus::INVALID_STATE;
+    return result;
+}
+}
+
+Utility::PurchaseResult VendingState::insertMoney(Context::MachineContext&, const CommonEnum::CoinCounts&) const {
+    return invalidState();
+}
+
+Utility::PurchaseResult VendingState::selectProduct(Context::MachineContext&, std::size_t) const {
+    return invalidState();
+}
+
+Utility::PurchaseResult VendingState::dispense(Context::MachineContext&) const {
+    return invalidState();
+}
+
+Utility::PurchaseResult VendingState::cancel(Context::MachineContext&) const {
+    return invalidState();
+}
+
+const VendingState& VendingState::forStatus(CommonEnum::MachineStatus status) {
+    static const ConcreteStates::IdleState idle;
+    static const ConcreteStates::HasMoneyState hasMoney;
+    static const ConcreteStates::DispensingState dispensing;
+    switch (status) {
+        case CommonEnum::MachineStatus::HAS_MONEY:
+            return hasMoney;
+        case CommonEnum::MachineStatus::DISPENSING:
+            return dispensing;
+        case CommonEnum::MachineStatus::IDLE:
+        default:
+            return idle;
+    }
+}
+
+} // namespace StateHandler
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include "CommonEnum/Coin.hpp"
+#include "CommonEnum/MachineStatus.hpp"
+#include "Utility/PurchaseResult.hpp"
+
+// Forward declaration
+namespace StateHandler {
+    namespace Context {
+        class MachineContext;
+    }
+}
+
+namespace StateHandler {
+
+// State pattern for a vending machine. States are stateless singletons
+// shared by the whole fleet; all per-machine data lives in MachineContext.
+// Every operation not allowed in a state answers INVALID_STATE.
+class VendingState {
+public:
+    virtual ~VendingState() = default;
+
+    virtual CommonEnum::MachineStatus getStatus() const = 0;
+    virtual Utility::PurchaseResult insertMoney(Context::MachineContext& context,
+                                                const CommonEnum::CoinCounts& coins) const;
+    virtual Utility::PurchaseResult selectProduct(Context::MachineContext& context, std::size_t slot) const;
+    virtual Utility::PurchaseResult dispense(Context::MachineContext& context) const;
+    virtual Utility::PurchaseResult cancel(Context::MachineContext& context) const;
+
+    // Shared instance for a status
+    static const VendingState& forStatus(CommonEnum::MachineStatus status);
+};
+
+} // namespace StateHandler
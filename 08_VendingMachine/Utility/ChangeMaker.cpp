@@ -0,0 +1,88 @@
+#include "ChangeMaker.hpp"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace Utility {
+
+ChangeMaker::ChangeMaker(uint32_t maxAmount) : unit(0), maxAmount(maxAmount) {
+    for (std::size_t coin = 0; coin < CommonEnum::COIN_COUNT; coin++) {
+        unit = std::gcd(unit, CommonEnum::coinValue(static_cast<CommonEnum::Coin>(coin)));
+    }
+    std::size_t steps = maxAmount / unit + 1;
+    minCoins.assign(steps, std::numeric_limits<uint16_t>::max());
+    lastCoin.assign(steps, 0);
+    minCoins[0] = 0;
+    for (std::size_t amount = 1; amount < steps; amount++) {
+        for (std::size_t coin = 0; coin < CommonEnum::COIN_COUNT; coin++) {
+            std::size_t value = CommonEnum::coinValue(static_cast<CommonEnum::Coin>(coin)) / unit;
+            if (value > amount || minCoins[amount - value] == std::numeric_limits<uint16_t>::max()) {
+                continue;
+            }
+            if (minCoins[amount - value] + 1 < minCoins[amount]) {
+                minCoins[amount] = static_cast<uint16_t>(minCoins[amount - value] + 1);
+                lastCoin[amount] = static_cast<uint8_t>(coin);
+            }
+        }
+    }
+}
+
+std::optional<CommonEnum::CoinCounts> ChangeMaker::makeChange(uint32_t amount) const {
+    if (amount % unit != 0 || amount > maxAmount) {
+        return std::nullopt;
+    }
+    std::size_t remaining = amount / unit;
+    if (minCoins[remaining] == std::numeric_limits<uint16_t>::max()) {
+        return std::nullopt;
+    }
+    CommonEnum::CoinCounts plan{};
+    while (remaining > 0) {
+        uint8_t coin = lastCoin[remaining];
+        plan[coin]++;
+        remaining -= CommonEnum::coinValue(static_cast<CommonEnum::Coin>(coin)) / unit;
+    }
+    return plan;
+}
+
+std::optional<CommonEnum::CoinCounts> ChangeMaker::makeChange(uint32_t amount,
+                                                              const CommonEnum::CoinCounts& available) const {
+    if (amount % unit != 0 || amount > maxAmount) {
+        return std::nullopt;
+    }
+    constexpr uint16_t UNREACHABLE = std::numeric_limits<uint16_t>::max();
+    std::size_t target = amount / unit;
+    // Adds one denomination at a time: best[a] is the fewest coins paying a
+    // units with the coins seen so far, taken[coin][a] how many of `coin`
+    // that uses
+    std::vector<uint16_t> best(target + 1, UNREACHABLE);
+    std::vector<uint16_t> next;
+    std::array<std::vector<uint16_t>, CommonEnum::COIN_COUNT> taken;
+    best[0] = 0;
+    for (std::size_t coin = 0; coin < CommonEnum::COIN_COUNT; coin++) {
+        std::size_t value = CommonEnum::coinValue(static_cast<CommonEnum::Coin>(coin)) / unit;
+        next.assign(target + 1, UNREACHABLE);
+        taken[coin].assign(target + 1, 0);
+        for (std::size_t reached = 0; reached <= target; reached++) {
+            std::size_t most = std::min<std::size_t>(available[coin], reached / value);
+            for (std::size_t count = 0; count <= most; count++) {
+                uint16_t before = best[reached - count * value];
+                if (before != UNREACHABLE && before + count < next[reached]) {
+                    next[reached] = static_cast<uint16_t>(before + count);
+                    taken[coin][reached] = static_cast<uint16_t>(count);
+                }
+            }
+        }
+        best.swap(next);
+    }
+    if (best[target] == UNREACHABLE) {
+        return std::nullopt;
+    }
+    CommonEnum::CoinCounts plan{};
+    for (std::size_t coin = CommonEnum::COIN_COUNT; coin-- > 0;) {
+        plan[coin] = taken[coin][target];
+        target -= plan[coin] * (CommonEnum::coinValue(static_cast<CommonEnum::Coin>(coin)) / unit);
+    }
+    return plan;
+}
+
+} // namespace Utility
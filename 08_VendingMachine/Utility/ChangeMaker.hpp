@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include "CommonEnum/Coin.hpp"
+
+namespace Utility {
+
+// Minimum-coin change computed once by dynamic programming over every
+// amount up to `maxAmount`, so making change at purchase time is a table
+// walk of at most a handful of steps. Amounts are stored in units of the
+// denominations' gcd (5 cents) to keep the table small.
+class ChangeMaker {
+private:
+    uint32_t unit;
+    uint32_t maxAmount;
+    std::vector<uint16_t> minCoins;  // per unit amount; UINT16_MAX when unreachable
+    std::vector<uint8_t> lastCoin;   // coin index used to reach that amount
+
+public:
+    explicit ChangeMaker(uint32_t maxAmount);
+
+    // Optimal coin plan for an amount in cents; nullopt if not representable
+    std::optional<CommonEnum::CoinCounts> makeChange(uint32_t amount) const;
+    // Fewest-coin plan using at most `available` of each coin, for when the
+    // hopper cannot pay the optimal plan; nullopt if the coins cannot make
+    // the amount. A small DP per call, so it is kept off the common path.
+    std::optional<CommonEnum::CoinCounts> makeChange(uint32_t amount, const CommonEnum::CoinCounts& available) const;
+
+    uint32_t getMaxAmount() const { return maxAmount; }
+};
+
+} // namespace Utility
@@ -0,0 +1,51 @@
+#include "CoinBox.hpp"
+
+namespace Utility {
+
+CoinBox::CoinBox(std::size_t machineCount)
+    : machineCount(machineCount), counts(new std::atomic<uint32_t>[machineCount * CommonEnum::COIN_COUNT]) {
+    for (std::size_t i = 0; i < machineCount * CommonEnum::COIN_COUNT; i++) {
+        counts[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void CoinBox::deposit(std::size_t machine, const CommonEnum::CoinCounts& coins) {
+    for (std::size_t coin = 0; coin < CommonEnum::COIN_COUNT; coin++) {
+        if (coins[coin]) {
+            at(machine, coin).fetch_add(coins[coin], std::memory_order_relaxed);
+        }
+    }
+}
+
+bool CoinBox::tryWithdraw(std::size_t machine, const CommonEnum::CoinCounts& coins) {
+    for (std::size_t coin = 0; coin < CommonEnum::COIN_COUNT; coin++) {
+        if (coins[coin] == 0) {
+            continue;
+        }
+        std::atomic<uint32_t>& count = at(machine, coin);
+        uint32_t current = count.load(std::memory_order_relaxed);
+        bool taken = false;
+        while (current >= coins[coin]) {
+            if (count.compare_exchange_weak(current, current - coins[coin], std::memory_order_relaxed)) {
+                taken = true;
+                break;
+            }
+        }
+        if (!taken) {
+            // Give back what this call already took
+            for (std::size_t undo = 0; undo < coin; undo++) {
+                if (coins[undo]) {
+                    at(machine, undo).fetch_add(coins[undo], std::memory_order_relaxed);
+                }
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t CoinBox::getCount(std::size_t machine, CommonEnum::Coin coin) const {
+    return at(machine, CommonEnum::coinIndex(coin)).load(std::memory_order_relaxed);
+}
+
+} // namespace Utility
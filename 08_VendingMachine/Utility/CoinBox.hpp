@@ -0,0 +1,31 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include "CommonEnum/Coin.hpp"
+
+namespace Utility {
+
+// Coin hopper counts for every machine, one flat atomic array
+class CoinBox {
+private:
+    std::size_t machineCount;
+    std::unique_ptr<std::atomic<uint32_t>[]> counts;
+
+public:
+    explicit CoinBox(std::size_t machineCount);
+
+    void deposit(std::size_t machine, const CommonEnum::CoinCounts& coins);
+    // All-or-nothing withdrawal; returns false (and takes nothing) if short
+    bool tryWithdraw(std::size_t machine, const CommonEnum::CoinCounts& coins);
+
+    uint32_t getCount(std::size_t machine, CommonEnum::Coin coin) const;
+
+private:
+    std::atomic<uint32_t>& at(std::size_t machine, std::size_t coin) const {
+        return counts[machine * CommonEnum::COIN_COUNT + coin];
+    }
+};
+
+} // namespace Utility
@@ -0,0 +1,46 @@
+#include "Inventory.hpp"
+
+namespace Utility {
+
+Inventory::Inventory(std::size_t machineCount, std::size_t slotsPerMachine)
+    : machineCount(machineCount), slotsPerMachine(slotsPerMachine),
+      stock(new std::atomic<uint32_t>[machineCount * slotsPerMachine]),
+      prices(new uint32_t[machineCount * slotsPerMachine]()) {
+    for (std::size_t i = 0; i < machineCount * slotsPerMachine; i++) {
+        stock[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+bool Inventory::tryTake(std::size_t machine, std::size_t slot) {
+    std::atomic<uint32_t>& count = stock[index(machine, slot)];
+    uint32_t current = count.load(std::memory_order_relaxed);
+    while (current > 0) {
+        if (count.compare_exchange_weak(current, current - 1, std::memory_order_acq_rel,
+                                        std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Inventory::restock(std::size_t machine, std::size_t slot, uint32_t quantity) {
+    stock[index(machine, slot)].fetch_add(quantity, std::memory_order_release);
+}
+
+void Inventory::setPrice(std::size_t machine, std::size_t slot, uint32_t cents) {
+    prices[index(machine, slot)] = cents;
+}
+
+uint32_t Inventory::getStock(std::size_t machine, std::size_t slot) const {
+    return stock[index(machine, slot)].load(std::memory_order_acquire);
+}
+
+uint64_t Inventory::getTotalStock() const {
+    uint64_t total = 0;
+    for (std::size_t i = 0; i < machineCount * slotsPerMachine; i++) {
+        total += stock[i].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+} // namespace Utility
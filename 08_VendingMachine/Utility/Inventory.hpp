@@ -0,0 +1,42 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace Utility {
+
+// Slot stock and prices for the whole fleet in flat arrays indexed by
+// machine * slotsPerMachine + slot. Stock is decremented with a CAS that
+// refuses to go below zero, so concurrent buyers can never oversell.
+class Inventory {
+private:
+    std::size_t machineCount;
+    std::size_t slotsPerMachine;
+    std::unique_ptr<std::atomic<uint32_t>[]> stock;
+    std::unique_ptr<uint32_t[]> prices;  // cents; written only while configuring
+
+public:
+    Inventory(std::size_t machineCount, std::size_t slotsPerMachine);
+
+    bool isValid(std::size_t machine, std::size_t slot) const {
+        return machine < machineCount && slot < slotsPerMachine;
+    }
+
+    // Take one item if any is left; returns false when sold out
+    bool tryTake(std::size_t machine, std::size_t slot);
+    void restock(std::size_t machine, std::size_t slot, uint32_t quantity);
+    void setPrice(std::size_t machine, std::size_t slot, uint32_t cents);
+
+    // Getters
+    uint32_t getStock(std::size_t machine, std::size_t slot) const;
+    uint32_t getPrice(std::size_t machine, std::size_t slot) const { return prices[index(machine, slot)]; }
+    std::size_t getMachineCount() const { return machineCount; }
+    std::size_t getSlotsPerMachine() const { return slotsPerMachine; }
+    uint64_t getTotalStock() const;
+
+private:
+    std::size_t index(std::size_t machine, std::size_t slot) const { return machine * slotsPerMachine + slot; }
+};
+
+} // namespace Utility
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "CommonEnum/Coin.hpp"
+#include "CommonEnum/MachineStatus.hpp"
+
+namespace Utility {
+
+struct PurchaseResult {
+    CommonEnum::PurchaseStatus status = CommonEnum::PurchaseStatus::INVALID_STATE;
+    CommonEnum::CoinCounts returned{};  // change on success, the refund otherwise
+
+    bool isSuccess() const { return status == CommonEnum::PurchaseStatus::SUCCESS; }
+};
+
+} // namespace Utility
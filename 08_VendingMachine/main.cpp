@@ -1,2 +1,72 @@
+#include "Controller/VendingFleet.hpp"
+#include "Benchmark/PurchaseBenchmark.hpp"
+#include <algorithm>
 #include <iostream>
-int main() { std::cout << "Vending Machine Implementation" << std::endl; return 0; }
+#include <thread>
+
+int main() {
+    std::cout << "Vending Machine Implementation" << std::endl;
+
+    const std::size_t machines = 5000;
+    const std::size_t slots = 24;
+    const uint32_t initialStock = 20;
+    Controller::VendingFleet fleet(machines, slots);
+
+    // Prices between 0.65 and 1.00, coin hoppers primed for change
+    CommonEnum::CoinCounts coinFloat{};
+    coinFloat[CommonEnum::coinIndex(CommonEnum::Coin::NICKEL)] = 1000;
+    coinFloat[CommonEnum::coinIndex(CommonEnum::Coin::DIME)] = 1000;
+    coinFloat[CommonEnum::coinIndex(CommonEnum::Coin::QUARTER)] = 1000;
+    for (std::size_t m = 0; m < machines; m++) {
+        for (std::size_t s = 0; s < slots; s++) {
+            fleet.getInventory().setPrice(m, s, 65 + 5 * static_cast<uint32_t>(s % 8));
+            fleet.getInventory().restock(m, s, initialStock);
+        }
+        fleet.getCoinBox().deposit(m, coinFloat);
+    }
+
+    // One front-panel session step by step
+    CommonEnum::CoinCounts payment{};
+    payment[CommonEnum::coinIndex(CommonEnum::Coin::DOLLAR)] = 1;
+    fleet.insertMoney(0, payment);
+    std::cout << "Machine 0: " << CommonEnum::machineStatusToString(fleet.getStatus(0)) << std::endl;
+    auto selected = fleet.selectProduct(0, 3);
+    std::cout << "Select slot 3: " << CommonEnum::purchaseStatusToString(selected.status)
+              << ", change " << CommonEnum::totalValue(selected.returned) << " cents, machine "
+              << CommonEnum::machineStatusToString(fleet.getStatus(0)) << std::endl;
+    fleet.dispense(0);
+    std::cout << "Machine 0: " << CommonEnum::machineStatusToString(fleet.getStatus(0)) << std::endl;
+
+    // Out of quarters: change has to come from the dimes and nickels left
+    Controller::VendingFleet lowFleet(1, 1);
+    CommonEnum::CoinCounts smallCoins{};
+    smallCoins[CommonEnum::coinIndex(CommonEnum::Coin::NICKEL)] = 1;
+    smallCoins[CommonEnum::coinIndex(CommonEnum::Coin::DIME)] = 2;
+    lowFleet.getInventory().setPrice(0, 0, 75);
+    lowFleet.getInventory().restock(0, 0, 1);
+    lowFleet.getCoinBox().deposit(0, smallCoins);
+    lowFleet.insertMoney(0, payment);
+    auto lowChange = lowFleet.selectProduct(0, 0);
+    std::cout << "No quarters in hopper: " << CommonEnum::purchaseStatusToString(lowChange.status)
+              << ", change " << CommonEnum::totalValue(lowChange.returned) << " cents in "
+              << lowChange.returned[CommonEnum::coinIndex(CommonEnum::Coin::DIME)] << " dimes and "
+              << lowChange.returned[CommonEnum::coinIndex(CommonEnum::Coin::NICKEL)] << " nickels" << std::endl;
+
+    auto unknown = fleet.insertMoney(fleet.getMachineCount(), payment);
+    std::cout << "Insert into machine " << fleet.getMachineCount() << ": "
+              << CommonEnum::purchaseStatusToString(unknown.status) << ", refunded "
+              << CommonEnum::totalValue(unknown.returned) << " cents" << std::endl;
+
+    uint64_t stockBefore = fleet.getInventory().getTotalStock();
+    int threads = static_cast<int>(std::max(4u, std::thread::hardware_concurrency()));
+    auto result = Benchmark::runPurchaseBenchmark(fleet, threads, 1000000);
+    uint64_t stockAfter = fleet.getInventory().getTotalStock();
+
+    std::cout << "Threads: " << threads << ", attempts: " << result.attempts << ", purchases: " << result.purchases
+              << ", busy: " << result.busy << ", sold out: " << result.soldOut
+              << ", other: " << result.otherFailures << std::endl;
+    std::cout << "Purchases/sec: " << static_cast<uint64_t>(result.purchasesPerSecond()) << std::endl;
+    std::cout << "Stock consistent (no oversell): "
+              << (stockBefore - stockAfter == result.purchases ? "yes" : "NO") << std::endl;
+    return 0;
+}
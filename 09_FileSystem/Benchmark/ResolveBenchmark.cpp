@@ -0,0 +1,66 @@
+#include "ResolveBenchmark.hpp"
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+
+namespace Benchmark {
+
+std::vector<std::string> populateTree(Controller::FileSystem& fileSystem, int projects, int modulesPerProject,
+                                      int filesPerModule, int sampleEvery) {
+    std::vector<std::string> sample;
+    char path[96];
+    uint64_t created = 0;
+    for (int p = 0; p < projects; p++) {
+        for (int m = 0; m < modulesPerProject; m++) {
+            std::snprintf(path, sizeof(path), "/proj%03d/module%02d", p, m);
+            if (fileSystem.mkdirs(path) != CommonEnum::FsStatus::SUCCESS) {
+                throw std::runtime_error(std::string("populateTree: mkdirs failed for ") + path);
+            }
+            for (int f = 0; f < filesPerModule; f++) {
+                std::snprintf(path, sizeof(path), "/proj%03d/module%02d/file%04d.src", p, m, f);
+                fileSystem.createFile(path);
+                if (created++ % sampleEvery == 0) {
+                    sample.emplace_back(path);
+                }
+            }
+        }
+    }
+    return sample;
+}
+
+ResolveResult runResolveBenchmark(const Controller::FileSystem& fileSystem, const std::vector<std::string>& paths,
+                                  int threads, uint64_t lookupsPerThread) {
+    std::vector<uint64_t> misses(threads * 8, 0);  // padded, one slot per thread
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            uint64_t state = 0x9E3779B97F4A7C15ULL * (t + 1);
+            uint64_t localMisses = 0;
+            Utility::NodeInfo info;
+            for (uint64_t i = 0; i < lookupsPerThread; i++) {
+                // xorshift64
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                if (fileSystem.stat(paths[state % paths.size()], info) != CommonEnum::FsStatus::SUCCESS) {
+                    localMisses++;
+                }
+            }
+            misses[t * 8] = localMisses;
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    ResolveResult result{};
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.resolutions = lookupsPerThread * threads;
+    for (int t = 0; t < threads; t++) {
+        result.misses += misses[t * 8];
+    }
+    return result;
+}
+
+} // namespace Benchmark
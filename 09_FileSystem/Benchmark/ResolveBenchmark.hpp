@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Controller/FileSystem.hpp"
+
+namespace Benchmark {
+
+struct ResolveResult {
+    uint64_t resolutions;
+    uint64_t misses;
+    double seconds;
+
+    double resolutionsPerSecond() const { return seconds > 0 ? resolutions / seconds : 0.0; }
+};
+
+// Builds /projNNN/moduleNN/fileNNNN.src under the root and returns every
+// `sampleEvery`-th file path for lookups
+std::vector<std::string> populateTree(Controller::FileSystem& fileSystem, int projects, int modulesPerProject,
+                                      int filesPerModule, int sampleEvery);
+
+// `threads` readers each stat() `lookupsPerThread` random paths from `paths`
+ResolveResult runResolveBenchmark(const Controller::FileSystem& fileSystem, const std::vector<std::string>& paths,
+                                  int threads, uint64_t lookupsPerThread);
+
+} // namespace Benchmark
@@ -0,0 +1,39 @@
+#include "NodeType.hpp"
+
+namespace CommonEnum {
+
+const char* nodeTypeToString(NodeType type) {
+    switch (type) {
+        case NodeType::FILE:
+            return "FILE";
+        case NodeType::DIRECTORY:
+            return "DIRECTORY";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+const char* fsStatusToString(FsStatus status) {
+    switch (status) {
+        case FsStatus::SUCCESS:
+            return "SUCCESS";
+        case FsStatus::NOT_FOUND:
+            return "NOT_FOUND";
+        case FsStatus::ALREADY_EXISTS:
+            return "ALREADY_EXISTS";
+        case FsStatus::NOT_A_DIRECTORY:
+            return "NOT_A_DIRECTORY";
+        case FsStatus::IS_A_DIRECTORY:
+            return "IS_A_DIRECTORY";
+        case FsStatus::DIRECTORY_NOT_EMPTY:
+            return "DIRECTORY_NOT_EMPTY";
+        case FsStatus::INVALID_PATH:
+            return "INVALID_PATH";
+        case FsStatus::FILE_TOO_LARGE:
+            return "FILE_TOO_LARGE";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+} // namespace CommonEnum
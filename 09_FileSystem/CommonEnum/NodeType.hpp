@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CommonEnum {
+
+enum class NodeType : uint8_t {
+    FILE,
+    DIRECTORY
+};
+
+enum class FsStatus {
+    SUCCESS,
+    NOT_FOUND,
+    ALREADY_EXISTS,
+    NOT_A_DIRECTORY,
+    IS_A_DIRECTORY,
+    DIRECTORY_NOT_EMPTY,
+    INVALID_PATH,
+    FILE_TOO_LARGE
+};
+
+// Utility functions for filesystem enums
+const char* nodeTypeToString(NodeType type);
+const char* fsStatusToString(FsStatus status);
+
+} // namespace CommonEnum
@@ -0,0 +1,292 @@
+#include "FileSystem.hpp"
+#include <algorithm>
+#include "Utility/PathView.hpp"
+
+namespace Controller {
+
+using CommonEnum::FsStatus;
+using CommonEnum::NodeType;
+
+namespace {
+
+// One step of a walk: ".." or a named child of a live directory
+Tree::Node* step(const Storage::NameTable& names, Tree::Node* current, std::string_view component, FsStatus& status) {
+    if (!current->isDirectory()) {
+        status = FsStatus::NOT_A_DIRECTORY;
+        return nullptr;
+    }
+    if (component == "..") {
+        return current->parent;
+    }
+    uint32_t nameId = names.find(component);
+    if (nameId == Storage::NameTable::INVALID_NAME) {
+        status = FsStatus::NOT_FOUND;  // a name never seen anywhere cannot exist here
+        return nullptr;
+    }
+    Tree::Node* child = current->directory->find(nameId);
+    if (!child || child->removed.load(std::memory_order_acquire)) {
+        status = FsStatus::NOT_FOUND;
+        return nullptr;
+    }
+    return child;
+}
+
+}
+
+FileSystem::FileSystem() : names(arena), clock(0), nodeCount(1) {
+    root = arena.create<Tree::Node>(NodeType::DIRECTORY, names.intern("/"), nullptr, tick());
+    root->parent = root;
+    root->directory = arena.create<Tree::Directory>();
+}
+
+Tree::Node* FileSystem::resolve(std::string_view path, FsStatus& status) const {
+    Utility::PathView components(path);
+    if (!components.isAbsolute()) {
+        status = FsStatus::INVALID_PATH;
+        return nullptr;
+    }
+    Tree::Node* current = root;
+    std::string_view component;
+    while (components.next(component)) {
+        current = step(names, current, component, status);
+        if (!current) {
+            return nullptr;
+        }
+    }
+    status = FsStatus::SUCCESS;
+    return current;
+}
+
+Tree::Node* FileSystem::resolveParent(std::string_view path, std::string_view& leaf, FsStatus& status) const {
+    Utility::PathView components(path);
+    if (!components.isAbsolute()) {
+        status = FsStatus::INVALID_PATH;
+        return nullptr;
+    }
+    // Walk one component behind so the last one is left over as the leaf
+    Tree::Node* current = root;
+    std::string_view pending, component;
+    bool havePending = false;
+    while (components.next(component)) {
+        if (havePending) {
+            current = step(names, current, pending, status);
+            if (!current) {
+                return nullptr;
+            }
+        }
+        pending = component;
+        havePending = true;
+    }
+    leaf = havePending ? pending : std::string_view();
+    status = FsStatus::SUCCESS;
+    return current;
+}
+
+Tree::Node* FileSystem::resolveFile(std::string_view path, FsStatus& status) const {
+    Tree::Node* node = resolve(path, status);
+    if (node && node->isDirectory()) {
+        status = FsStatus::IS_A_DIRECTORY;
+        return nullptr;
+    }
+    return node;
+}
+
+FsStatus FileSystem::create(Tree::Node* parent, std::string_view leaf, NodeType type) {
+    if (leaf.empty()) {
+        return FsStatus::ALREADY_EXISTS;  // the root
+    }
+    if (leaf == "..") {
+        return FsStatus::INVALID_PATH;
+    }
+    if (!parent->isDirectory()) {
+        return FsStatus::NOT_A_DIRECTORY;
+    }
+    uint32_t nameId = names.intern(leaf);
+    auto lock = parent->directory->lockForWrite();
+    if (parent->removed.load(std::memory_order_relaxed)) {
+        return FsStatus::NOT_FOUND;
+    }
+    Tree::Node* existing = parent->directory->find(nameId);
+    if (existing) {
+        return FsStatus::ALREADY_EXISTS;
+    }
+    uint64_t now = tick();
+    Tree::Node* node = arena.create<Tree::Node>(type, nameId, parent, now);
+    if (type == NodeType::DIRECTORY) {
+        node->directory = arena.create<Tree::Directory>();
+    } else {
+        node->contents = arena.create<Storage::FileContents>();
+    }
+    parent->directory->insert(nameId, node);
+    parent->modified.store(now, std::memory_order_relaxed);
+    nodeCount.fetch_add(1, std::memory_order_relaxed);
+    return FsStatus::SUCCESS;
+}
+
+FsStatus FileSystem::mkdir(std::string_view path) {
+    FsStatus status;
+    std::string_view leaf;
+    Tree::Node* parent = resolveParent(path, leaf, status);
+    return parent ? create(parent, leaf, NodeType::DIRECTORY) : status;
+}
+
+FsStatus FileSystem::mkdirs(std::string_view path) {
+    Utility::PathView components(path);
+    if (!components.isAbsolute()) {
+        return FsStatus::INVALID_PATH;
+    }
+    Tree::Node* current = root;
+    std::string_view component;
+    while (components.next(component)) {
+        FsStatus status;
+        Tree::Node* next = step(names, current, component, status);
+        if (!next && status == FsStatus::NOT_FOUND) {
+            status = create(current, component, NodeType::DIRECTORY);
+            if (status != FsStatus::SUCCESS && status != FsStatus::ALREADY_EXISTS) {
+                return status;
+            }
+            next = step(names, current, component, status);  // ours, or a racing creator's
+        }
+        if (!next) {
+            return status;
+        }
+        current = next;
+    }
+    return current->isDirectory() ? FsStatus::SUCCESS : FsStatus::NOT_A_DIRECTORY;
+}
+
+FsStatus FileSystem::createFile(std::string_view path) {
+    FsStatus status;
+    std::string_view leaf;
+    Tree::Node* parent = resolveParent(path, leaf, status);
+    return parent ? create(parent, leaf, NodeType::FILE) : status;
+}
+
+FsStatus FileSystem::remove(std::string_view path) {
+    FsStatus status;
+    std::string_view leaf;
+    Tree::Node* parent = resolveParent(path, leaf, status);
+    if (!parent) {
+        return status;
+    }
+    if (leaf.empty() || leaf == "..") {
+        return FsStatus::INVALID_PATH;
+    }
+    if (!parent->isDirectory()) {
+        return FsStatus::NOT_A_DIRECTORY;
+    }
+    uint32_t nameId = names.find(leaf);
+    if (nameId == Storage::NameTable::INVALID_NAME) {
+        return FsStatus::NOT_FOUND;
+    }
+
+    Tree::Node* node;
+    {
+        auto lock = parent->directory->lockForWrite();
+        node = parent->directory->find(nameId);
+        if (!node) {
+            return FsStatus::NOT_FOUND;
+        }
+        // Parent before child; marking a directory removed under its own
+        // lock stops concurrent creates inside it
+        std::unique_lock<std::mutex> childLock;
+        if (node->isDirectory()) {
+            childLock = node->directory->lockForWrite();
+            if (node->directory->getEntryCount() > 0) {
+                return FsStatus::DIRECTORY_NOT_EMPTY;
+            }
+        }
+        node->removed.store(true, std::memory_order_release);
+        parent->directory->erase(nameId);
+        parent->modified.store(tick(), std::memory_order_relaxed);
+    }
+    if (node->contents) {
+        node->contents->release(chunks);
+    }
+    nodeCount.fetch_sub(1, std::memory_order_relaxed);
+    return FsStatus::SUCCESS;
+}
+
+FsStatus FileSystem::write(std::string_view path, uint64_t offset, std::string_view data) {
+    FsStatus status;
+    Tree::Node* node = resolveFile(path, status);
+    if (!node) {
+        return status;
+    }
+    if (!node->contents->write(chunks, offset, data)) {
+        return FsStatus::FILE_TOO_LARGE;
+    }
+    node->modified.store(tick(), std::memory_order_relaxed);
+    return FsStatus::SUCCESS;
+}
+
+FsStatus FileSystem::append(std::string_view path, std::string_view data) {
+    FsStatus status;
+    Tree::Node* node = resolveFile(path, status);
+    if (!node) {
+        return status;
+    }
+    if (!node->contents->append(chunks, data)) {
+        return FsStatus::FILE_TOO_LARGE;
+    }
+    node->modified.store(tick(), std::memory_order_relaxed);
+    return FsStatus::SUCCESS;
+}
+
+FsStatus FileSystem::truncate(std::string_view path, uint64_t size) {
+    FsStatus status;
+    Tree::Node* node = resolveFile(path, status);
+    if (!node) {
+        return status;
+    }
+    if (!node->contents->truncate(chunks, size)) {
+        return FsStatus::FILE_TOO_LARGE;
+    }
+    node->modified.store(tick(), std::memory_order_relaxed);
+    return FsStatus::SUCCESS;
+}
+
+FsStatus FileSystem::read(std::string_view path, uint64_t offset, std::size_t length, std::string& out) const {
+    FsStatus status;
+    Tree::Node* node = resolveFile(path, status);
+    if (!node) {
+        return status;
+    }
+    node->contents->read(offset, length, out);
+    return FsStatus::SUCCESS;
+}
+
+FsStatus FileSystem::list(std::string_view path, std::vector<std::string>& out) const {
+    FsStatus status;
+    Tree::Node* node = resolve(path, status);
+    if (!node) {
+        return status;
+    }
+    if (!node->isDirectory()) {
+        return FsStatus::NOT_A_DIRECTORY;
+    }
+    out.clear();
+    node->directory->forEach([&](const Tree::Node* child) { out.emplace_back(names.nameOf(child->nameId)); });
+    std::sort(out.begin(), out.end());
+    return FsStatus::SUCCESS;
+}
+
+FsStatus FileSystem::stat(std::string_view path, Utility::NodeInfo& out) const {
+    FsStatus status;
+    Tree::Node* node = resolve(path, status);
+    if (!node) {
+        return status;
+    }
+    out.name = names.nameOf(node->nameId);
+    out.type = node->type;
+    out.size = node->isDirectory() ? node->directory->getEntryCount() : node->contents->getSize();
+    out.modified = node->modified.load(std::memory_order_relaxed);
+    return FsStatus::SUCCESS;
+}
+
+bool FileSystem::exists(std::string_view path) const {
+    FsStatus status;
+    return resolve(path, status) != nullptr;
+}
+
+} // namespace Controller
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "CommonEnum/NodeType.hpp"
+#include "Storage/Arena.hpp"
+#include "Storage/ChunkPool.hpp"
+#include "Storage/NameTable.hpp"
+#include "Tree/Directory.hpp"
+#include "Tree/Node.hpp"
+#include "Utility/NodeInfo.hpp"
+
+namespace Controller {
+
+// In-memory hierarchical filesystem. Paths are absolute, '/'-separated;
+// "." and ".." are understood and repeated slashes ignored.
+//
+// Path resolution walks the name-interned trie without locks or heap
+// allocation, so stat/ls/read scale with readers. Creating or unlinking an
+// entry locks only its parent directory (and, for rmdir, the directory
+// itself, always parent before child).
+//
+// Because readers may still hold an unlinked node, removing an entry does
+// not reclaim its metadata: the node, its directory table and its
+// FileContents stay in the arena until the FileSystem is destroyed. A
+// removed file's data chunks do go back to the pool at once. A workload
+// that keeps creating and removing entries therefore grows
+// getMetadataBytes() without bound; reclaiming it would need a grace
+// period (epochs or hazard pointers) that this class does not implement.
+class FileSystem {
+private:
+    Storage::Arena arena;
+    Storage::NameTable names;
+    Storage::ChunkPool chunks;
+    Tree::Node* root;
+    std::atomic<uint64_t> clock;
+    std::atomic<uint64_t> nodeCount;
+
+public:
+    FileSystem();
+
+    CommonEnum::FsStatus mkdir(std::string_view path);
+    // Creates missing parents too; succeeds if the directory already exists
+    CommonEnum::FsStatus mkdirs(std::string_view path);
+    CommonEnum::FsStatus createFile(std::string_view path);
+    // Removes a file or an empty directory
+    CommonEnum::FsStatus remove(std::string_view path);
+
+    // Files are sparse and limited to Storage::FileContents::MAX_FILE_SIZE;
+    // growing one past that is FILE_TOO_LARGE and changes nothing
+    CommonEnum::FsStatus write(std::string_view path, uint64_t offset, std::string_view data);
+    CommonEnum::FsStatus append(std::string_view path, std::string_view data);
+    CommonEnum::FsStatus truncate(std::string_view path, uint64_t size);
+    CommonEnum::FsStatus read(std::string_view path, uint64_t offset, std::size_t length, std::string& out) const;
+
+    // Sorted entry names
+    CommonEnum::FsStatus list(std::string_view path, std::vector<std::string>& out) const;
+    CommonEnum::FsStatus stat(std::string_view path, Utility::NodeInfo& out) const;
+    bool exists(std::string_view path) const;
+
+    // Getters
+    uint64_t getNodeCount() const { return nodeCount.load(std::memory_order_relaxed); }
+    uint32_t getNameCount() const { return names.getCount(); }
+    std::size_t getMetadataBytes() { return arena.getBytesReserved(); }
+    std::size_t getDataChunks() { return chunks.getChunksInUse(); }
+
+private:
+    // Lock-free walk; nullptr with `status` set on failure
+    Tree::Node* resolve(std::string_view path, CommonEnum::FsStatus& status) const;
+    // Resolves everything but the last component
+    Tree::Node* resolveParent(std::string_view path, std::string_view& leaf, CommonEnum::FsStatus& status) const;
+    CommonEnum::FsStatus create(Tree::Node* parent, std::string_view leaf, CommonEnum::NodeType type);
+    Tree::Node* resolveFile(std::string_view path, CommonEnum::FsStatus& status) const;
+    uint64_t tick() { return clock.fetch_add(1, std::memory_order_relaxed) + 1; }
+};
+
+} // namespace Controller
@@ -0,0 +1,44 @@
+#include "Arena.hpp"
+#include <algorithm>
+#include <cstdint>
+
+namespace Storage {
+
+Arena::Arena(std::size_t blockSize) : blockSize(blockSize), cursor(nullptr), remaining(0), bytesUsed(0), bytesReserved(0) {}
+
+Arena::~Arena() {
+    for (auto it = destructors.rbegin(); it != destructors.rend(); ++it) {
+        it->destroy(it->object);
+    }
+}
+
+void* Arena::allocate(std::size_t size, std::size_t alignment) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t padding = (alignment - reinterpret_cast<uintptr_t>(cursor) % alignment) % alignment;
+    if (cursor == nullptr || padding + size > remaining) {
+        // Oversized requests get a block of their own
+        std::size_t bytes = std::max(blockSize, size + alignment);
+        blocks.push_back(std::unique_ptr<char[]>(new char[bytes]));
+        cursor = blocks.back().get();
+        remaining = bytes;
+        bytesReserved += bytes;
+        padding = (alignment - reinterpret_cast<uintptr_t>(cursor) % alignment) % alignment;
+    }
+    char* result = cursor + padding;
+    cursor += padding + size;
+    remaining -= padding + size;
+    bytesUsed += size;
+    return result;
+}
+
+std::size_t Arena::getBytesUsed() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return bytesUsed;
+}
+
+std::size_t Arena::getBytesReserved() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return bytesReserved;
+}
+
+} // namespace Storage
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Storage {
+
+// Bump allocator for long-lived filesystem metadata (names, nodes, child
+// tables). Nothing is freed individually: memory and any registered
+// destructors are released together when the arena goes away, which is
+// also what lets lock-free readers keep using a node after it is unlinked.
+class Arena {
+private:
+    struct Destructor {
+        void* object;
+        void (*destroy)(void*);
+    };
+
+    std::mutex mutex;
+    std::vector<std::unique_ptr<char[]>> blocks;
+    std::vector<Destructor> destructors;
+    std::size_t blockSize;
+    char* cursor;
+    std::size_t remaining;
+    std::size_t bytesUsed;
+    std::size_t bytesReserved;
+
+public:
+    explicit Arena(std::size_t blockSize = 1 << 20);
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        T* object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        if (!std::is_trivially_destructible<T>::value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            destructors.push_back({object, [](void* p) { static_cast<T*>(p)->~T(); }});
+        }
+        return object;
+    }
+
+    // Getters
+    std::size_t getBytesUsed();
+    std::size_t getBytesReserved();
+};
+
+} // namespace Storage
@@ -0,0 +1,38 @@
+#include "ChunkPool.hpp"
+#include <cstring>
+
+namespace Storage {
+
+ChunkPool::ChunkPool() : chunksInUse(0) {}
+
+char* ChunkPool::allocate() {
+    char* chunk;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (freeChunks.empty()) {
+            slabs.push_back(std::unique_ptr<char[]>(new char[CHUNK_SIZE * CHUNKS_PER_SLAB]));
+            char* slab = slabs.back().get();
+            for (std::size_t i = CHUNKS_PER_SLAB; i-- > 0;) {
+                freeChunks.push_back(slab + i * CHUNK_SIZE);
+            }
+        }
+        chunk = freeChunks.back();
+        freeChunks.pop_back();
+        chunksInUse++;
+    }
+    std::memset(chunk, 0, CHUNK_SIZE);
+    return chunk;
+}
+
+void ChunkPool::release(char* chunk) {
+    std::lock_guard<std::mutex> lock(mutex);
+    freeChunks.push_back(chunk);
+    chunksInUse--;
+}
+
+std::size_t ChunkPool::getChunksInUse() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return chunksInUse;
+}
+
+} // namespace Storage
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Storage {
+
+// Fixed-size blocks for file contents, carved from large slabs and recycled
+// through a free list, so file growth never reallocates or copies data.
+class ChunkPool {
+public:
+    static constexpr std::size_t CHUNK_SIZE = 4096;
+
+private:
+    static constexpr std::size_t CHUNKS_PER_SLAB = 256;
+
+    std::mutex mutex;
+    std::vector<std::unique_ptr<char[]>> slabs;
+    std::vector<char*> freeChunks;
+    std::size_t chunksInUse;
+
+public:
+    ChunkPool();
+
+    // Returns a zero-filled chunk
+    char* allocate();
+    void release(char* chunk);
+
+    // Getters
+    std::size_t getChunksInUse();
+};
+
+} // namespace Storage
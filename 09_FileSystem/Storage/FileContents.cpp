@@ -0,0 +1,126 @@
+#include "FileContents.hpp"
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace Storage {
+
+namespace {
+
+std::size_t chunksFor(uint64_t bytes) {
+    return static_cast<std::size_t>((bytes + ChunkPool::CHUNK_SIZE - 1) / ChunkPool::CHUNK_SIZE);
+}
+
+}
+
+FileContents::FileContents() : size(0), released(false) {}
+
+bool FileContents::write(ChunkPool& pool, uint64_t offset, std::string_view data) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    return writeLocked(pool, offset, data);
+}
+
+bool FileContents::append(ChunkPool& pool, std::string_view data) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    return writeLocked(pool, size.load(std::memory_order_relaxed), data);
+}
+
+bool FileContents::writeLocked(ChunkPool& pool, uint64_t offset, std::string_view data) {
+    // Written this way round so offset + size cannot wrap
+    if (offset > MAX_FILE_SIZE || data.size() > MAX_FILE_SIZE - offset) {
+        return false;
+    }
+    if (released || data.empty()) {
+        return true;
+    }
+    uint64_t end = offset + data.size();
+    if (chunks.size() < chunksFor(end)) {
+        chunks.resize(chunksFor(end), nullptr);
+    }
+    std::size_t copied = 0;
+    while (copied < data.size()) {
+        uint64_t position = offset + copied;
+        std::size_t within = static_cast<std::size_t>(position % ChunkPool::CHUNK_SIZE);
+        std::size_t count = std::min(ChunkPool::CHUNK_SIZE - within, data.size() - copied);
+        char*& chunk = chunks[position / ChunkPool::CHUNK_SIZE];
+        if (!chunk) {
+            chunk = pool.allocate();
+        }
+        std::memcpy(chunk + within, data.data() + copied, count);
+        copied += count;
+    }
+    if (end > size.load(std::memory_order_relaxed)) {
+        size.store(end, std::memory_order_release);
+    }
+    return true;
+}
+
+void FileContents::read(uint64_t offset, std::size_t length, std::string& out) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    out.clear();
+    uint64_t current = size.load(std::memory_order_relaxed);
+    if (offset >= current) {
+        return;
+    }
+    std::size_t count = static_cast<std::size_t>(std::min<uint64_t>(length, current - offset));
+    out.resize(count);  // zero-filled, so holes need no copy
+    std::size_t copied = 0;
+    while (copied < count) {
+        uint64_t position = offset + copied;
+        std::size_t within = static_cast<std::size_t>(position % ChunkPool::CHUNK_SIZE);
+        std::size_t step = std::min(ChunkPool::CHUNK_SIZE - within, count - copied);
+        if (const char* chunk = chunks[position / ChunkPool::CHUNK_SIZE]) {
+            std::memcpy(&out[copied], chunk + within, step);
+        }
+        copied += step;
+    }
+}
+
+bool FileContents::truncate(ChunkPool& pool, uint64_t newSize) {
+    if (newSize > MAX_FILE_SIZE) {
+        return false;
+    }
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    if (released) {
+        return true;
+    }
+    // Growing only extends the hole
+    std::size_t needed = chunksFor(newSize);
+    while (chunks.size() > needed) {
+        if (chunks.back()) {
+            pool.release(chunks.back());
+        }
+        chunks.pop_back();
+    }
+    chunks.resize(needed, nullptr);
+    // Bytes past the end are kept zero, so shrinking only clears the tail
+    // of the last kept chunk
+    std::size_t within = static_cast<std::size_t>(newSize % ChunkPool::CHUNK_SIZE);
+    if (newSize < size.load(std::memory_order_relaxed) && within && chunks.back()) {
+        std::memset(chunks.back() + within, 0, ChunkPool::CHUNK_SIZE - within);
+    }
+    size.store(newSize, std::memory_order_release);
+    return true;
+}
+
+void FileContents::release(ChunkPool& pool) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    for (char* chunk : chunks) {
+        if (chunk) {
+            pool.release(chunk);
+        }
+    }
+    chunks.clear();
+    chunks.shrink_to_fit();
+    size.store(0, std::memory_order_release);
+    released = true;
+}
+
+std::size_t FileContents::getChunkCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return static_cast<std::size_t>(std::count_if(chunks.begin(), chunks.end(), [](const char* chunk) {
+        return chunk != nullptr;
+    }));
+}
+
+} // namespace Storage
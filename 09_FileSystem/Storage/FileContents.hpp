@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Storage/ChunkPool.hpp"
+
+namespace Storage {
+
+// Bytes of one file as a table of fixed-size chunks. Readers share the
+// lock; writes, truncation and release take it exclusively. The size is
+// also kept in an atomic so stat() needs no lock. The file is sparse:
+// chunks are allocated only when written, and holes left by writing past
+// the end or growing with truncate read back as zeros.
+class FileContents {
+public:
+    // Largest size a file may reach; keeps the chunk table (one pointer
+    // per 4 KiB) at 2 MiB even for a file that is all hole
+    static constexpr uint64_t MAX_FILE_SIZE = 1ULL << 30;
+
+private:
+    mutable std::shared_mutex mutex;
+    std::vector<char*> chunks;   // nullptr for a hole
+    std::atomic<uint64_t> size;  // written under the exclusive lock
+    bool released;
+
+public:
+    FileContents();
+
+    // These return false, changing nothing, if the file would end past
+    // MAX_FILE_SIZE
+    bool write(ChunkPool& pool, uint64_t offset, std::string_view data);
+    bool append(ChunkPool& pool, std::string_view data);
+    bool truncate(ChunkPool& pool, uint64_t newSize);
+    // Replaces `out` with up to `length` bytes from `offset`
+    void read(uint64_t offset, std::size_t length, std::string& out) const;
+    // Returns every chunk to the pool; later writes are ignored
+    void release(ChunkPool& pool);
+
+    // Getters
+    uint64_t getSize() const { return size.load(std::memory_order_acquire); }
+    // Allocated chunks only, not holes
+    std::size_t getChunkCount() const;
+
+private:
+    bool writeLocked(ChunkPool& pool, uint64_t offset, std::string_view data);
+};
+
+} // namespace Storage
@@ -0,0 +1,106 @@
+#include "NameTable.hpp"
+#include <cstring>
+#include <stdexcept>
+
+namespace Storage {
+
+NameTable::Slots::Slots(std::size_t capacity) : mask(capacity - 1), ids(new std::atomic<uint32_t>[capacity]) {
+    for (std::size_t i = 0; i < capacity; i++) {
+        ids[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+NameTable::NameTable(Arena& arena) : arena(arena), chunks(new std::atomic<Entry*>[MAX_CHUNKS]), count(0) {
+    for (uint32_t i = 0; i < MAX_CHUNKS; i++) {
+        chunks[i].store(nullptr, std::memory_order_relaxed);
+    }
+    generations.push_back(std::make_unique<Slots>(1024));
+    slots.store(generations.back().get(), std::memory_order_release);
+}
+
+uint64_t NameTable::hash(std::string_view name) {
+    // FNV-1a
+    uint64_t h = 14695981039346656037ULL;
+    for (char c : name) {
+        h = (h ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+    }
+    return h;
+}
+
+uint32_t NameTable::probe(const Slots& table, std::string_view name, uint64_t h, std::size_t& slot) const {
+    slot = h & table.mask;
+    while (true) {
+        uint32_t stored = table.ids[slot].load(std::memory_order_acquire);
+        if (stored == 0) {
+            return INVALID_NAME;
+        }
+        const Entry& entry = entryOf(stored - 1);
+        if (entry.hash == h && entry.length == name.size() && std::memcmp(entry.data, name.data(), name.size()) == 0) {
+            return stored - 1;
+        }
+        slot = (slot + 1) & table.mask;
+    }
+}
+
+uint32_t NameTable::find(std::string_view name) const {
+    std::size_t slot;
+    return probe(*slots.load(std::memory_order_acquire), name, hash(name), slot);
+}
+
+uint32_t NameTable::intern(std::string_view name) {
+    uint64_t h = hash(name);
+    std::lock_guard<std::mutex> lock(writeMutex);
+    std::size_t slot;
+    uint32_t existing = probe(*slots.load(std::memory_order_relaxed), name, h, slot);
+    if (existing != INVALID_NAME) {
+        return existing;
+    }
+
+    uint32_t id = count.load(std::memory_order_relaxed);
+    if ((id >> CHUNK_BITS) >= MAX_CHUNKS) {
+        throw std::length_error("NameTable: too many distinct names");
+    }
+    if ((id & (CHUNK_SIZE - 1)) == 0) {
+        auto* chunk = static_cast<Entry*>(arena.allocate(sizeof(Entry) * CHUNK_SIZE, alignof(Entry)));
+        chunks[id >> CHUNK_BITS].store(chunk, std::memory_order_release);
+    }
+    char* data = static_cast<char*>(arena.allocate(name.size() ? name.size() : 1, 1));
+    std::memcpy(data, name.data(), name.size());
+    chunks[id >> CHUNK_BITS].load(std::memory_order_relaxed)[id & (CHUNK_SIZE - 1)] =
+        Entry{data, static_cast<uint32_t>(name.size()), h};
+
+    // Keep the load factor under 1/2 so probes stay short
+    Slots* table = slots.load(std::memory_order_relaxed);
+    if ((id + 1) * 2 > table->mask + 1) {
+        grow();
+        table = slots.load(std::memory_order_relaxed);
+        probe(*table, name, h, slot);
+    }
+    table->ids[slot].store(id + 1, std::memory_order_release);
+    count.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+std::string_view NameTable::nameOf(uint32_t id) const {
+    const Entry& entry = entryOf(id);
+    return std::string_view(entry.data, entry.length);
+}
+
+void NameTable::grow() {
+    const Slots& old = *slots.load(std::memory_order_relaxed);
+    auto bigger = std::make_unique<Slots>((old.mask + 1) * 2);
+    for (std::size_t i = 0; i <= old.mask; i++) {
+        uint32_t stored = old.ids[i].load(std::memory_order_relaxed);
+        if (stored) {
+            std::size_t slot = entryOf(stored - 1).hash & bigger->mask;
+            while (bigger->ids[slot].load(std::memory_order_relaxed)) {
+                slot = (slot + 1) & bigger->mask;
+            }
+            bigger->ids[slot].store(stored, std::memory_order_relaxed);
+        }
+    }
+    slots.store(bigger.get(), std::memory_order_release);
+    generations.push_back(std::move(bigger));
+}
+
+} // namespace Storage
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+#include "Storage/Arena.hpp"
+
+namespace Storage {
+
+// Interns path components: every distinct name is stored once in the arena
+// and identified by a dense 32-bit id, so directories key their children by
+// integer and repeated names ("src", "index.html") cost nothing extra.
+//
+// find() is lock-free and never allocates: it probes the current hash
+// table snapshot. intern() serializes on a mutex; when the table grows the
+// new one is published atomically and the old one is kept until
+// destruction, so readers still probing it stay safe.
+class NameTable {
+public:
+    static constexpr uint32_t INVALID_NAME = UINT32_MAX;
+
+private:
+    struct Entry {
+        const char* data;
+        uint32_t length;
+        uint64_t hash;
+    };
+
+    struct Slots {
+        std::size_t mask;
+        std::unique_ptr<std::atomic<uint32_t>[]> ids;  // id + 1, 0 = empty
+
+        explicit Slots(std::size_t capacity);
+    };
+
+    static constexpr uint32_t CHUNK_BITS = 12;
+    static constexpr uint32_t CHUNK_SIZE = 1u << CHUNK_BITS;
+    static constexpr uint32_t MAX_CHUNKS = 1u << 16;
+
+    Arena& arena;
+    std::unique_ptr<std::atomic<Entry*>[]> chunks;  // id -> entry, in fixed chunks that never move
+    std::atomic<Slots*> slots;
+    std::vector<std::unique_ptr<Slots>> generations;
+    std::atomic<uint32_t> count;
+    std::mutex writeMutex;
+
+public:
+    explicit NameTable(Arena& arena);
+
+    uint32_t find(std::string_view name) const;
+    uint32_t intern(std::string_view name);
+    std::string_view nameOf(uint32_t id) const;
+
+    // Getters
+    uint32_t getCount() const { return count.load(std::memory_order_acquire); }
+
+    static uint64_t hash(std::string_view name);
+
+private:
+    const Entry& entryOf(uint32_t id) const {
+        return chunks[id >> CHUNK_BITS].load(std::memory_order_acquire)[id & (CHUNK_SIZE - 1)];
+    }
+    uint32_t probe(const Slots& table, std::string_view name, uint64_t hash, std::size_t& slot) const;
+    void grow();
+};
+
+} // namespace Storage
@@ -0,0 +1,107 @@
+#include "Directory.hpp"
+
+namespace Tree {
+
+Directory::ChildTable::ChildTable(std::size_t capacity)
+    : mask(capacity - 1), keys(new std::atomic<uint32_t>[capacity]), nodes(new std::atomic<Node*>[capacity]), used(0) {
+    for (std::size_t i = 0; i < capacity; i++) {
+        keys[i].store(0, std::memory_order_relaxed);
+        nodes[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+Directory::Directory() : entryCount(0) {
+    generations.push_back(std::make_unique<ChildTable>(8));
+    children.store(generations.back().get(), std::memory_order_release);
+}
+
+Node* Directory::find(uint32_t nameId) const {
+    const ChildTable* table = children.load(std::memory_order_acquire);
+    std::size_t slot = slotOf(nameId, table->mask);
+    while (true) {
+        uint32_t key = table->keys[slot].load(std::memory_order_acquire);
+        if (key == 0) {
+            return nullptr;
+        }
+        if (key == nameId + 1) {
+            return table->nodes[slot].load(std::memory_order_acquire);
+        }
+        slot = (slot + 1) & table->mask;
+    }
+}
+
+bool Directory::insert(uint32_t nameId, Node* child) {
+    ChildTable* table = children.load(std::memory_order_relaxed);
+    // Grow at 3/4 occupancy, counting slots of unlinked names too
+    if ((table->used + 1) * 4 > (table->mask + 1) * 3) {
+        std::size_t capacity = 8;
+        while (capacity * 3 < (entryCount.load(std::memory_order_relaxed) + 1) * 8) {
+            capacity *= 2;
+        }
+        rehash(capacity);
+        table = children.load(std::memory_order_relaxed);
+    }
+    std::size_t slot = slotOf(nameId, table->mask);
+    while (true) {
+        uint32_t key = table->keys[slot].load(std::memory_order_relaxed);
+        if (key == nameId + 1) {
+            if (table->nodes[slot].load(std::memory_order_relaxed)) {
+                return false;
+            }
+            break;
+        }
+        if (key == 0) {
+            table->used++;
+            break;
+        }
+        slot = (slot + 1) & table->mask;
+    }
+    // Publish the node before the key so a reader that sees the key sees the node
+    table->nodes[slot].store(child, std::memory_order_release);
+    table->keys[slot].store(nameId + 1, std::memory_order_release);
+    entryCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+Node* Directory::erase(uint32_t nameId) {
+    ChildTable* table = children.load(std::memory_order_relaxed);
+    std::size_t slot = slotOf(nameId, table->mask);
+    while (true) {
+        uint32_t key = table->keys[slot].load(std::memory_order_relaxed);
+        if (key == 0) {
+            return nullptr;
+        }
+        if (key == nameId + 1) {
+            Node* node = table->nodes[slot].load(std::memory_order_relaxed);
+            if (node) {
+                table->nodes[slot].store(nullptr, std::memory_order_release);
+                entryCount.fetch_sub(1, std::memory_order_relaxed);
+            }
+            return node;
+        }
+        slot = (slot + 1) & table->mask;
+    }
+}
+
+void Directory::rehash(std::size_t capacity) {
+    const ChildTable* old = children.load(std::memory_order_relaxed);
+    auto table = std::make_unique<ChildTable>(capacity);
+    for (std::size_t i = 0; i <= old->mask; i++) {
+        Node* node = old->nodes[i].load(std::memory_order_relaxed);
+        if (!node) {
+            continue;  // drop unlinked names
+        }
+        uint32_t key = old->keys[i].load(std::memory_order_relaxed);
+        std::size_t slot = slotOf(key - 1, table->mask);
+        while (table->keys[slot].load(std::memory_order_relaxed)) {
+            slot = (slot + 1) & table->mask;
+        }
+        table->nodes[slot].store(node, std::memory_order_relaxed);
+        table->keys[slot].store(key, std::memory_order_relaxed);
+        table->used++;
+    }
+    children.store(table.get(), std::memory_order_release);
+    generations.push_back(std::move(table));
+}
+
+} // namespace Tree
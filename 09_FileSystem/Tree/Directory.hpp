@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "Tree/Node.hpp"
+
+namespace Tree {
+
+// Children of one directory in an open-addressing table keyed by interned
+// name id. Lookups and listings are RCU-style: they read the current table
+// snapshot with acquire loads and take no lock. Mutations serialize on the
+// directory's own mutex; a table that fills up is replaced by a larger one
+// published atomically, and superseded tables are kept until the directory
+// is destroyed so in-flight readers never touch freed memory.
+class Directory {
+private:
+    struct ChildTable {
+        std::size_t mask;
+        std::unique_ptr<std::atomic<uint32_t>[]> keys;  // nameId + 1, 0 = empty
+        std::unique_ptr<std::atomic<Node*>[]> nodes;    // nullptr = unlinked
+        std::size_t used;                               // key slots taken, writer-only
+
+        explicit ChildTable(std::size_t capacity);
+    };
+
+    std::mutex writeMutex;
+    std::atomic<ChildTable*> children;
+    std::vector<std::unique_ptr<ChildTable>> generations;
+    std::atomic<uint32_t> entryCount;
+
+public:
+    Directory();
+
+    // Lock-free; nullptr if absent
+    Node* find(uint32_t nameId) const;
+
+    std::unique_lock<std::mutex> lockForWrite() { return std::unique_lock<std::mutex>(writeMutex); }
+    // The following require lockForWrite() to be held
+    bool insert(uint32_t nameId, Node* child);  // false if the name is taken
+    Node* erase(uint32_t nameId);                // the unlinked node, or nullptr
+
+    // Visits live children of the current snapshot; lock-free
+    template <typename Visitor>
+    void forEach(Visitor visit) const {
+        const ChildTable* table = children.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i <= table->mask; i++) {
+            if (table->keys[i].load(std::memory_order_acquire)) {
+                Node* node = table->nodes[i].load(std::memory_order_acquire);
+                if (node && !node->removed.load(std::memory_order_acquire)) {
+                    visit(node);
+                }
+            }
+        }
+    }
+
+    // Getters
+    uint32_t getEntryCount() const { return entryCount.load(std::memory_order_relaxed); }
+
+private:
+    static std::size_t slotOf(uint32_t nameId, std::size_t mask) {
+        return static_cast<std::size_t>((nameId * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+    }
+    void rehash(std::size_t capacity);
+};
+
+} // namespace Tree
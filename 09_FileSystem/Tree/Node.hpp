@@ -0,0 +1,31 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include "CommonEnum/NodeType.hpp"
+#include "Storage/FileContents.hpp"
+
+namespace Tree {
+
+class Directory;
+
+// One trie node per path component. Nodes live in the arena for the
+// filesystem's lifetime; unlinking only sets `removed`, so a reader that
+// resolved the node just before keeps a valid pointer.
+struct Node {
+    CommonEnum::NodeType type;
+    uint32_t nameId;
+    Node* parent;                     // root points at itself
+    Directory* directory;             // DIRECTORY only
+    Storage::FileContents* contents;  // FILE only
+    std::atomic<bool> removed;
+    std::atomic<uint64_t> modified;   // logical clock of the last change
+
+    Node(CommonEnum::NodeType type, uint32_t nameId, Node* parent, uint64_t created)
+        : type(type), nameId(nameId), parent(parent), directory(nullptr), contents(nullptr),
+          removed(false), modified(created) {}
+
+    bool isDirectory() const { return type == CommonEnum::NodeType::DIRECTORY; }
+};
+
+} // namespace Tree
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include "CommonEnum/NodeType.hpp"
+
+namespace Utility {
+
+struct NodeInfo {
+    std::string_view name;  // interned; valid for the filesystem's lifetime
+    CommonEnum::NodeType type;
+    uint64_t size;         // bytes for files, entries for directories
+    uint64_t modified;     // logical clock of the last change
+};
+
+} // namespace Utility
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string_view>
+
+namespace Utility {
+
+// Walks the components of a path without copying: empty components
+// ("a//b") and "." are skipped, ".." is returned as-is for the caller.
+class PathView {
+private:
+    std::string_view path;
+    std::size_t position;
+
+public:
+    explicit PathView(std::string_view path) : path(path), position(0) {}
+
+    bool isAbsolute() const { return !path.empty() && path.front() == '/'; }
+
+    bool next(std::string_view& component) {
+        while (position < path.size()) {
+            std::size_t end = path.find('/', position);
+            if (end == std::string_view::npos) {
+                end = path.size();
+            }
+            component = path.substr(position, end - position);
+            position = end + 1;
+            if (!component.empty() && component != ".") {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+} // namespace Utility
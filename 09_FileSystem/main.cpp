@@ -0,0 +1,56 @@
+#include "Controller/FileSystem.hpp"
+#include "Benchmark/ResolveBenchmark.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+int main(int argc, char* argv[]) {
+    std::cout << "File System Implementation" << std::endl;
+
+    Controller::FileSystem fs;
+    fs.mkdirs("/home/alice/docs");
+    fs.createFile("/home/alice/docs/notes.txt");
+    fs.write("/home/alice/docs/notes.txt", 0, "hello, ");
+    fs.append("/home/alice/docs/notes.txt", "filesystem");
+    std::string content;
+    fs.read("/home/alice/./docs//notes.txt", 0, 64, content);
+    std::cout << "Read back: " << content << std::endl;
+
+    std::vector<std::string> entries;
+    fs.list("/home/alice/docs/..", entries);
+    std::cout << "ls /home/alice:";
+    for (const auto& entry : entries) {
+        std::cout << " " << entry;
+    }
+    std::cout << std::endl;
+    std::cout << "rmdir non-empty: " << CommonEnum::fsStatusToString(fs.remove("/home/alice/docs")) << std::endl;
+    std::cout << "mkdir under a file: "
+              << CommonEnum::fsStatusToString(fs.mkdir("/home/alice/docs/notes.txt/x")) << std::endl;
+
+    // Sparse files: only written chunks are allocated and holes read as zeros
+    fs.createFile("/home/alice/sparse.bin");
+    fs.write("/home/alice/sparse.bin", 512 << 20, "tail");
+    fs.read("/home/alice/sparse.bin", (512 << 20) - 2, 6, content);
+    std::cout << "Sparse 512 MiB file: " << fs.getDataChunks() << " data chunks in use, hole+tail reads "
+              << (content == std::string("\0\0tail", 6) ? "zeros then data" : "WRONG") << std::endl;
+    std::cout << "Write past the size limit: "
+              << CommonEnum::fsStatusToString(fs.write("/home/alice/sparse.bin", UINT64_MAX - 1, "xy")) << std::endl;
+
+    // Path resolution at millions of entries: default 200 x 10 x 1000 = 2M files
+    int projects = argc > 1 ? std::atoi(argv[1]) : 200;
+    auto buildStart = std::chrono::steady_clock::now();
+    Controller::FileSystem big;
+    auto paths = Benchmark::populateTree(big, projects, 10, 1000, 7);
+    double buildSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - buildStart).count();
+    std::cout << "Built " << big.getNodeCount() << " nodes (" << big.getNameCount() << " interned names, "
+              << big.getMetadataBytes() / (1 << 20) << " MiB metadata) in " << buildSeconds << "s" << std::endl;
+
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int t = 1; t <= threads; t *= 2) {
+        auto result = Benchmark::runResolveBenchmark(big, paths, t, 2000000);
+        std::cout << "Threads: " << t << ", resolutions/sec: " << static_cast<uint64_t>(result.resolutionsPerSecond())
+                  << ", misses: " << result.misses << std::endl;
+    }
+    return 0;
+}
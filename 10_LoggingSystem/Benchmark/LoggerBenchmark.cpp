@@ -0,0 +1,135 @@
+#include "LoggerBenchmark.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Controller/LogMacros.hpp"
+#include "Sinks/ConcreteSinks/FileSink.hpp"
+#include "Utility/TickClock.hpp"
+
+namespace Benchmark {
+
+namespace {
+
+constexpr uint64_t SAMPLE_EVERY = 16;
+
+struct ThreadTiming {
+    double seconds = 0;
+    std::vector<uint64_t> samples;   // ticks per sampled call
+};
+
+// Runs body(thread, i) perThread times on each thread, timing the whole
+// loop and sampling individual calls
+template <typename Body>
+std::vector<ThreadTiming> runThreads(int threads, uint64_t perThread, Body body) {
+    std::vector<ThreadTiming> timings(threads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            ThreadTiming& timing = timings[t];
+            timing.samples.reserve(perThread / SAMPLE_EVERY + 1);
+            auto start = std::chrono::steady_clock::now();
+            for (uint64_t i = 0; i < perThread; ++i) {
+                if (i % SAMPLE_EVERY == 0) {
+                    uint64_t before = Utility::readTicks();
+                    body(t, i);
+                    timing.samples.push_back(Utility::readTicks() - before);
+                } else {
+                    body(t, i);
+                }
+            }
+            timing.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return timings;
+}
+
+void summarize(LoggingResult& result, std::vector<ThreadTiming>& timings, double nanosPerTick) {
+    double callerSeconds = 0;
+    std::vector<uint64_t> samples;
+    for (auto& timing : timings) {
+        callerSeconds += timing.seconds;
+        samples.insert(samples.end(), timing.samples.begin(), timing.samples.end());
+    }
+    result.callerNanos = callerSeconds * 1e9 / static_cast<double>(result.messages);
+    std::sort(samples.begin(), samples.end());
+    auto at = [&](double quantile) {
+        return samples.empty() ? 0.0
+             : static_cast<double>(samples[static_cast<std::size_t>(quantile * (samples.size() - 1))]) * nanosPerTick;
+    };
+    result.p50Nanos = at(0.50);
+    result.p99Nanos = at(0.99);
+    result.p999Nanos = at(0.999);
+}
+
+}
+
+LoggingResult runAsyncLogging(const std::string& name, const Controller::LoggerConfig& config,
+                              int threads, uint64_t perThread, const std::string& path) {
+    LoggingResult result{name, threads, static_cast<uint64_t>(threads) * perThread, 0, 0, 0, 0, 0, 0, 0, 0};
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::shared_ptr<Sinks::LogSink>> sinks{std::make_shared<Sinks::ConcreteSinks::FileSink>(path, true)};
+    Controller::Logger logger(sinks, config);
+    auto timings = runThreads(threads, perThread, [&](int thread, uint64_t i) {
+        LOG_INFO(logger, "order {} filled at {} for {} by worker {}", i, 100.25 + static_cast<double>(i % 100), "ACME", thread);
+    });
+    logger.flush();
+    result.drainSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    Controller::LoggerStats stats = logger.getStats();
+    result.written = stats.written;
+    result.dropped = stats.dropped;
+    result.blocked = stats.blocked;
+    Utility::TickConverter converter(std::chrono::milliseconds(10));
+    summarize(result, timings, converter.getNanosPerTick());
+    return result;
+}
+
+LoggingResult runCoutLogging(int threads, uint64_t perThread, const std::string& path) {
+    LoggingResult result{"std::cout", threads, static_cast<uint64_t>(threads) * perThread, 0, 0, 0, 0, 0, 0, 0, 0};
+    std::ofstream file(path, std::ios::trunc);
+    std::streambuf* original = std::cout.rdbuf(file.rdbuf());
+    std::mutex coutMutex;
+
+    auto start = std::chrono::steady_clock::now();
+    auto timings = runThreads(threads, perThread, [&](int thread, uint64_t i) {
+        auto now = std::chrono::system_clock::now();
+        std::time_t seconds = std::chrono::system_clock::to_time_t(now);
+        long micros = static_cast<long>(std::chrono::duration_cast<std::chrono::microseconds>(
+            now.time_since_epoch()).count() % 1000000);
+        std::tm utc;
+        gmtime_r(&seconds, &utc);
+        std::lock_guard<std::mutex> lock(coutMutex);
+        std::cout << std::put_time(&utc, "%Y-%m-%d %H:%M:%S") << '.' << std::setw(6) << std::setfill('0') << micros
+                  << " INFO  LoggerBenchmark.cpp:" << __LINE__ << " order " << i << " filled at "
+                  << 100.25 + static_cast<double>(i % 100) << " for " << "ACME" << " by worker " << thread << '\n';
+    });
+    std::cout.flush();
+    result.drainSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout.rdbuf(original);
+    result.written = result.messages;
+
+    Utility::TickConverter converter(std::chrono::milliseconds(10));
+    summarize(result, timings, converter.getNanosPerTick());
+    return result;
+}
+
+void printResult(const LoggingResult& result) {
+    std::printf("%-18s threads=%d msgs=%llu  call mean %7.1f ns  p50 %6.0f  p99 %7.0f  p99.9 %8.0f ns  "
+                "drained in %.3fs (%.2fM written/s)  written=%llu dropped=%llu blocked=%llu\n",
+                result.name.c_str(), result.threads, static_cast<unsigned long long>(result.messages),
+                result.callerNanos, result.p50Nanos, result.p99Nanos, result.p999Nanos, result.drainSeconds,
+                static_cast<double>(result.written) / result.drainSeconds / 1e6,
+                static_cast<unsigned long long>(result.written), static_cast<unsigned long long>(result.dropped), static_cast<unsigned long long>(result.blocked));
+}
+
+} // namespace Benchmark
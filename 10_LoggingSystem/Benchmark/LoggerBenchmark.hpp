@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "Controller/Logger.hpp"
+
+namespace Benchmark {
+
+struct LoggingResult {
+    std::string name;
+    int threads;
+    uint64_t messages;
+    double callerNanos;     // mean time inside the log call, on the producer threads
+    double p50Nanos;        // sampled per-call latency
+    double p99Nanos;
+    double p999Nanos;
+    double drainSeconds;    // until every message reached the sink
+    uint64_t written;       // messages that reached the sink; throughput counts only these
+    uint64_t dropped;
+    uint64_t blocked;
+};
+
+// Each thread logs perThread messages with three arguments through an
+// asynchronous Logger writing to path
+LoggingResult runAsyncLogging(const std::string& name, const Controller::LoggerConfig& config,
+                              int threads, uint64_t perThread, const std::string& path);
+
+// Baseline: the same lines formatted and written synchronously through
+// std::cout (redirected to path) under a mutex, as a typical simple logger
+LoggingResult runCoutLogging(int threads, uint64_t perThread, const std::string& path);
+
+void printResult(const LoggingResult& result);
+
+} // namespace Benchmark
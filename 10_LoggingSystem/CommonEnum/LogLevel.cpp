@@ -0,0 +1,26 @@
+#include "LogLevel.hpp"
+
+namespace CommonEnum {
+
+const char* logLevelToString(LogLevel level) {
+    switch (level) {
+        case LogLevel::TRACE:
+            return "TRACE";
+        case LogLevel::DEBUG:
+            return "DEBUG";
+        case LogLevel::INFO:
+            return "INFO";
+        case LogLevel::WARN:
+            return "WARN";
+        case LogLevel::ERROR:
+            return "ERROR";
+        case LogLevel::FATAL:
+            return "FATAL";
+        case LogLevel::OFF:
+            return "OFF";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+} // namespace CommonEnum
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CommonEnum {
+
+enum class LogLevel : uint8_t {
+    TRACE,
+    DEBUG,
+    INFO,
+    WARN,
+    ERROR,
+    FATAL,
+    OFF
+};
+
+// Utility function to convert LogLevel to string
+const char* logLevelToString(LogLevel level);
+
+} // namespace CommonEnum
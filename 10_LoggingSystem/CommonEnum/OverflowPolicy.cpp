@@ -0,0 +1,16 @@
+#include "OverflowPolicy.hpp"
+
+namespace CommonEnum {
+
+const char* overflowPolicyToString(OverflowPolicy policy) {
+    switch (policy) {
+        case OverflowPolicy::BLOCK:
+            return "BLOCK";
+        case OverflowPolicy::DROP:
+            return "DROP";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+} // namespace CommonEnum
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace CommonEnum {
+
+// What a producer does when its ring is full
+enum class OverflowPolicy {
+    BLOCK,  // wait for the background thread to make room
+    DROP    // discard the record and count it
+};
+
+// Utility function to convert OverflowPolicy to string
+const char* overflowPolicyToString(OverflowPolicy policy);
+
+} // namespace CommonEnum
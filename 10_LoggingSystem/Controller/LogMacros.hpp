@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Controller/Logger.hpp"
+
+// Statements below LOG_ACTIVE_LEVEL are discarded at compile time; build
+// with e.g. -DLOG_ACTIVE_LEVEL=2 to strip TRACE and DEBUG entirely. The
+// logger's runtime level filters the rest with one relaxed load.
+#ifndef LOG_ACTIVE_LEVEL
+#define LOG_ACTIVE_LEVEL 0
+#endif
+
+#define LOG_AT(logger, messageLevel, format, ...)                                                 \
+    do {                                                                                          \
+        if constexpr (messageLevel >= static_cast<CommonEnum::LogLevel>(LOG_ACTIVE_LEVEL)) {      \
+            if ((logger).isEnabled(messageLevel)) {                                               \
+                static constexpr Record::LogSite logSite{messageLevel, __FILE__, __LINE__, format}; \
+                (logger).log(logSite, ##__VA_ARGS__);                                             \
+            }                                                                                     \
+        }                                                                                         \
+    } while (0)
+
+#define LOG_TRACE(logger, ...) LOG_AT(logger, CommonEnum::LogLevel::TRACE, __VA_ARGS__)
+#define LOG_DEBUG(logger, ...) LOG_AT(logger, CommonEnum::LogLevel::DEBUG, __VA_ARGS__)
+#define LOG_INFO(logger, ...) LOG_AT(logger, CommonEnum::LogLevel::INFO, __VA_ARGS__)
+#define LOG_WARN(logger, ...) LOG_AT(logger, CommonEnum::LogLevel::WARN, __VA_ARGS__)
+#define LOG_ERROR(logger, ...) LOG_AT(logger, CommonEnum::LogLevel::ERROR, __VA_ARGS__)
+#define LOG_FATAL(logger, ...) LOG_AT(logger, CommonEnum::LogLevel::FATAL, __VA_ARGS__)
@@ -0,0 +1,282 @@
+#include "Logger.hpp"
+#include <algorithm>
+#include <charconv>
+#include <ctime>
+
+namespace Controller {
+
+namespace {
+
+std::atomic<uint64_t> nextLoggerId{1};
+
+constexpr std::size_t PREFIX_LENGTH = 19;   // "YYYY-MM-DD HH:MM:SS"
+constexpr std::size_t LEVEL_WIDTH = 5;
+
+constexpr int BLOCK_SPINS = 16;
+constexpr std::chrono::microseconds BLOCK_SLEEP(20);
+
+const char* baseName(const char* path) {
+    const char* slash = std::strrchr(path, '/');
+    return slash != nullptr ? slash + 1 : path;
+}
+
+}
+
+thread_local Logger::ThreadBinding Logger::lastBinding = {0, nullptr};
+
+Logger::Logger(std::vector<std::shared_ptr<Sinks::LogSink>> sinks, const LoggerConfig& config)
+    : id(nextLoggerId.fetch_add(1, std::memory_order_relaxed)), config(config), sinks(std::move(sinks)),
+      level(config.level), registryVersion(0), running(true), flushRequested(0), flushCompleted(0),
+      written(0), bytesWritten(0), batches(0), cachedSecond(-1), cachedPrefix{} {
+    batch.reserve(config.batchBytes + 4096);
+    worker = std::thread(&Logger::run, this);
+}
+
+Logger::~Logger() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        running.store(false, std::memory_order_release);
+    }
+    wakeCondition.notify_one();
+    worker.join();
+    for (auto& sink : sinks) {
+        sink->flush();
+    }
+}
+
+Logger::ThreadBuffer& Logger::bindThread() {
+    // Owns this thread's buffers for every logger it has used; marks them
+    // retired on thread exit so the background thread can release them
+    // once drained
+    struct Holder {
+        std::vector<std::pair<uint64_t, std::shared_ptr<ThreadBuffer>>> buffers;
+
+        ~Holder() {
+            for (auto& entry : buffers) {
+                entry.second->retired.store(true, std::memory_order_release);
+            }
+            lastBinding = {0, nullptr};
+        }
+    };
+    static thread_local Holder holder;
+
+    for (auto& entry : holder.buffers) {
+        if (entry.first == id) {
+            lastBinding = {id, entry.second.get()};
+            return *entry.second;
+        }
+    }
+    auto buffer = std::make_shared<ThreadBuffer>(config.ringBytes);
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        buffers.push_back(buffer);
+        registryVersion.fetch_add(1, std::memory_order_release);
+    }
+    holder.buffers.emplace_back(id, buffer);
+    lastBinding = {id, buffer.get()};
+    return *buffer;
+}
+
+char* Logger::reserveSlow(ThreadBuffer& buffer, std::size_t size) {
+    if (size > buffer.ring.getCapacity() || config.overflowPolicy == CommonEnum::OverflowPolicy::DROP) {
+        bump(buffer.dropped);
+        return nullptr;
+    }
+    bump(buffer.blocked);
+    // The background thread may be idling; wake it rather than wait out
+    // its sleep, then back off from yielding to sleeping so a spinning
+    // producer does not starve it of CPU
+    wakeCondition.notify_one();
+    char* slot;
+    for (int attempt = 0; (slot = buffer.ring.reserve(size)) == nullptr; ++attempt) {
+        if (!running.load(std::memory_order_relaxed)) {
+            bump(buffer.dropped);
+            return nullptr;
+        }
+        if (attempt < BLOCK_SPINS) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(BLOCK_SLEEP);
+        }
+    }
+    return slot;
+}
+
+void Logger::run() {
+    std::vector<std::shared_ptr<ThreadBuffer>> snapshot;
+    uint64_t snapshotVersion = UINT64_MAX;
+    while (true) {
+        bool stopping = !running.load(std::memory_order_acquire);
+        uint64_t flushTarget = flushRequested.load(std::memory_order_acquire);
+        uint64_t version = registryVersion.load(std::memory_order_acquire);
+        if (version != snapshotVersion) {
+            std::lock_guard<std::mutex> lock(registryMutex);
+            snapshot = buffers;
+            snapshotVersion = registryVersion.load(std::memory_order_relaxed);
+        }
+
+        std::size_t drained = 0;
+        for (auto& buffer : snapshot) {
+            drained += drain(*buffer);
+        }
+        // flushCompleted is only written by this thread, so it can be read
+        // without wakeMutex here
+        bool flushPending = flushTarget > flushCompleted;
+        if (drained != 0 && !flushPending) {
+            continue;
+        }
+
+        // Either every ring was empty or a flush is waiting: push out the
+        // partial batch. drain() empties each ring, so this pass covered
+        // everything committed before flushTarget was read, even if
+        // producers never let the rings go idle
+        writeBatch();
+        if (drained == 0) {
+            // Release buffers whose threads have exited
+            bool pruned = false;
+            for (auto& buffer : snapshot) {
+                if (buffer->retired.load(std::memory_order_acquire) && buffer->ring.empty()) {
+                    std::lock_guard<std::mutex> lock(registryMutex);
+                    retiredTotals.logged += buffer->logged.load(std::memory_order_relaxed);
+                    retiredTotals.dropped += buffer->dropped.load(std::memory_order_relaxed);
+                    retiredTotals.blocked += buffer->blocked.load(std::memory_order_relaxed);
+                    buffers.erase(std::find(buffers.begin(), buffers.end(), buffer));
+                    registryVersion.fetch_add(1, std::memory_order_release);
+                    pruned = true;
+                }
+            }
+            if (pruned) {
+                snapshotVersion = UINT64_MAX;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        if (flushPending) {
+            for (auto& sink : sinks) {
+                sink->flush();
+            }
+            flushCompleted = flushTarget;
+            flushCondition.notify_all();
+        }
+        if (drained != 0) {
+            continue;
+        }
+        if (stopping) {
+            break;
+        }
+        wakeCondition.wait_for(lock, config.idleSleep, [this] {
+            return !running.load(std::memory_order_relaxed)
+                || flushRequested.load(std::memory_order_relaxed) > flushCompleted;
+        });
+    }
+}
+
+std::size_t Logger::drain(ThreadBuffer& buffer) {
+    std::size_t records = 0;
+    while (true) {
+        std::size_t available;
+        const char* data = buffer.ring.peek(available);
+        if (available == 0) {
+            break;
+        }
+        std::size_t consumed = 0;
+        bool wrapped = false;
+        while (consumed < available) {
+            // A wrap marker can be as short as its first word
+            const Record::LogSite* site;
+            std::memcpy(&site, data + consumed, sizeof(site));
+            if (site == nullptr) {
+                wrapped = true;
+                break;
+            }
+            Record::RecordHeader header;
+            std::memcpy(&header, data + consumed, sizeof(header));
+            appendRecord(header, data + consumed + sizeof(header));
+            consumed += header.size;
+            ++records;
+            if (batch.size() >= config.batchBytes) {
+                writeBatch();
+            }
+        }
+        buffer.ring.release(consumed);
+        if (wrapped) {
+            buffer.ring.skipToStart();
+        }
+    }
+    return records;
+}
+
+void Logger::appendRecord(const Record::RecordHeader& header, const char* args) {
+    int64_t nanos = tickConverter.toEpochNanos(header.ticks);
+    int64_t second = nanos / 1000000000;
+    if (second != cachedSecond) {
+        std::time_t seconds = static_cast<std::time_t>(second);
+        std::tm utc;
+        gmtime_r(&seconds, &utc);
+        std::strftime(cachedPrefix, sizeof(cachedPrefix), "%Y-%m-%d %H:%M:%S", &utc);
+        cachedSecond = second;
+    }
+    // Fixed-width prefix built by hand: snprintf alone would cost more
+    // than formatting the message
+    const Record::LogSite& site = *header.site;
+    char stamp[8];
+    int micros = static_cast<int>(nanos % 1000000000 / 1000);
+    stamp[0] = '.';
+    for (int digit = 6; digit >= 1; --digit, micros /= 10) {
+        stamp[digit] = static_cast<char>('0' + micros % 10);
+    }
+    stamp[7] = ' ';
+    batch.append(cachedPrefix, PREFIX_LENGTH);
+    batch.append(stamp, sizeof(stamp));
+    const char* levelName = CommonEnum::logLevelToString(site.level);
+    std::size_t levelLength = std::strlen(levelName);
+    batch.append(levelName, levelLength);
+    batch.append(LEVEL_WIDTH + 1 - std::min(levelLength, LEVEL_WIDTH), ' ');
+    batch += baseName(site.file);
+    batch.push_back(':');
+    char line[16];
+    auto result = std::to_chars(line, line + sizeof(line), site.line);
+    *result.ptr++ = ' ';
+    batch.append(line, result.ptr);
+    header.format(site, args, batch);
+    batch.push_back('\n');
+    bump(written);
+}
+
+void Logger::writeBatch() {
+    if (batch.empty()) {
+        return;
+    }
+    for (auto& sink : sinks) {
+        sink->write(batch.data(), batch.size());
+    }
+    bytesWritten.store(bytesWritten.load(std::memory_order_relaxed) + batch.size(), std::memory_order_relaxed);
+    bump(batches);
+    batch.clear();
+}
+
+void Logger::flush() {
+    uint64_t target = flushRequested.fetch_add(1, std::memory_order_acq_rel) + 1;
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    wakeCondition.notify_one();
+    flushCondition.wait(lock, [&] {
+        return flushCompleted >= target || !running.load(std::memory_order_relaxed);
+    });
+}
+
+LoggerStats Logger::getStats() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    LoggerStats stats = retiredTotals;
+    for (const auto& buffer : buffers) {
+        stats.logged += buffer->logged.load(std::memory_order_relaxed);
+        stats.dropped += buffer->dropped.load(std::memory_order_relaxed);
+        stats.blocked += buffer->blocked.load(std::memory_order_relaxed);
+    }
+    stats.written = written.load(std::memory_order_relaxed);
+    stats.bytesWritten = bytesWritten.load(std::memory_order_relaxed);
+    stats.batches = batches.load(std::memory_order_relaxed);
+    stats.producerThreads = buffers.size();
+    return stats;
+}
+
+} // namespace Controller
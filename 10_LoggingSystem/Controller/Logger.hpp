@@ -0,0 +1,159 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "CommonEnum/LogLevel.hpp"
+#include "CommonEnum/OverflowPolicy.hpp"
+#include "Record/RecordCodec.hpp"
+#include "Ring/ByteRing.hpp"
+#include "Sinks/LogSink.hpp"
+#include "Utility/TickClock.hpp"
+
+namespace Controller {
+
+struct LoggerConfig {
+    std::size_t ringBytes = 1 << 20;   // per producer thread
+    CommonEnum::OverflowPolicy overflowPolicy = CommonEnum::OverflowPolicy::BLOCK;
+    CommonEnum::LogLevel level = CommonEnum::LogLevel::INFO;
+    std::size_t batchBytes = 64 << 10; // formatted bytes handed to the sinks at once
+    std::chrono::microseconds idleSleep = std::chrono::microseconds(200);
+};
+
+struct LoggerStats {
+    uint64_t logged = 0;        // records accepted into a ring
+    uint64_t dropped = 0;       // records discarded under DROP (or too large for a ring)
+    uint64_t blocked = 0;       // records that had to wait for room under BLOCK
+    uint64_t written = 0;       // records formatted and handed to the sinks
+    uint64_t bytesWritten = 0;
+    uint64_t batches = 0;
+    std::size_t producerThreads = 0;
+};
+
+// Asynchronous logger. Each producer thread gets its own SPSC byte ring
+// and appends binary records: the call site's address as format id, a
+// formatter function pointer, a TSC timestamp and the raw arguments. No
+// formatting, allocation or locking happens on the caller's thread once
+// its ring exists. A background thread drains every ring, formats the
+// records and hands the text to the sinks in large batches.
+//
+// Ordering is preserved per thread; lines from different threads are
+// interleaved by drain order, not by timestamp.
+class Logger {
+private:
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    struct ThreadBuffer {
+        Ring::ByteRing ring;
+        // Written only by the owning thread, read by getStats()
+        alignas(CACHE_LINE) std::atomic<uint64_t> logged;
+        std::atomic<uint64_t> dropped;
+        std::atomic<uint64_t> blocked;
+        std::atomic<bool> retired;   // owning thread has exited
+
+        explicit ThreadBuffer(std::size_t ringBytes)
+            : ring(ringBytes), logged(0), dropped(0), blocked(0), retired(false) {}
+    };
+
+    struct ThreadBinding {
+        uint64_t loggerId;
+        ThreadBuffer* buffer;
+    };
+
+    // Last logger this thread logged through; a plain POD so the check
+    // needs no TLS initialization guard
+    static thread_local ThreadBinding lastBinding;
+
+    uint64_t id;
+    LoggerConfig config;
+    std::vector<std::shared_ptr<Sinks::LogSink>> sinks;
+    std::atomic<CommonEnum::LogLevel> level;
+    Utility::TickConverter tickConverter;
+
+    std::mutex registryMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::atomic<uint64_t> registryVersion;
+    LoggerStats retiredTotals;   // counters of buffers already removed
+
+    std::atomic<bool> running;
+    std::atomic<uint64_t> flushRequested;
+    uint64_t flushCompleted;
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable flushCondition;
+
+    // Background thread state
+    std::atomic<uint64_t> written;
+    std::atomic<uint64_t> bytesWritten;
+    std::atomic<uint64_t> batches;
+    std::string batch;
+    int64_t cachedSecond;
+    char cachedPrefix[32];
+    std::thread worker;
+
+    ThreadBuffer& localBuffer() {
+        if (lastBinding.loggerId == id) {
+            return *lastBinding.buffer;
+        }
+        return bindThread();
+    }
+
+    static void bump(std::atomic<uint64_t>& counter) {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    ThreadBuffer& bindThread();
+    char* reserveSlow(ThreadBuffer& buffer, std::size_t size);
+    void run();
+    std::size_t drain(ThreadBuffer& buffer);
+    void appendRecord(const Record::RecordHeader& header, const char* args);
+    void writeBatch();
+
+public:
+    explicit Logger(std::vector<std::shared_ptr<Sinks::LogSink>> sinks, const LoggerConfig& config = LoggerConfig());
+    // Drains every ring and flushes the sinks
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    bool isEnabled(CommonEnum::LogLevel messageLevel) const {
+        return messageLevel >= level.load(std::memory_order_relaxed);
+    }
+    void setLevel(CommonEnum::LogLevel newLevel) { level.store(newLevel, std::memory_order_relaxed); }
+
+    // Hot path, normally reached through the LOG_* macros
+    template <typename... Args>
+    void log(const Record::LogSite& site, const Args&... args) {
+        std::size_t size = Record::alignRecord(sizeof(Record::RecordHeader) + Record::payloadSize(args...));
+        ThreadBuffer& buffer = localBuffer();
+        char* slot = buffer.ring.reserve(size);
+        if (slot == nullptr && (slot = reserveSlow(buffer, size)) == nullptr) {
+            return;
+        }
+        Record::RecordHeader header{&site, &Record::formatRecord<std::decay_t<Args>...>,
+                                    Utility::readTicks(), static_cast<uint32_t>(size), 0};
+        std::memcpy(slot, &header, sizeof(header));
+        Record::encodeArgs(slot + sizeof(header), args...);
+        buffer.ring.commit(size);
+        bump(buffer.logged);
+    }
+
+    // Blocks until every record logged before the call has reached the sinks
+    void flush();
+
+    // Getters
+    CommonEnum::LogLevel getLevel() const { return level.load(std::memory_order_relaxed); }
+    CommonEnum::OverflowPolicy getOverflowPolicy() const { return config.overflowPolicy; }
+    LoggerStats getStats();
+};
+
+} // namespace Controller
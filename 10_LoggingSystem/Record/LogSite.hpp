@@ -0,0 +1,17 @@
+#pragma once
+
+#include "CommonEnum/LogLevel.hpp"
+
+namespace Record {
+
+// Everything about a log statement that is known at compile time. Each
+// LOG_* call site owns one static instance; its address is the record's
+// format id, so the hot path never copies the format string.
+struct LogSite {
+    CommonEnum::LogLevel level;
+    const char* file;
+    int line;
+    const char* format;
+};
+
+} // namespace Record
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "Record/LogSite.hpp"
+
+namespace Record {
+
+// Renders a record's message (site format plus decoded args) onto out
+using FormatFn = void (*)(const LogSite& site, const char* args, std::string& out);
+
+// Fixed prefix of every record in a thread ring, followed by the raw args.
+// A null site marks the unused tail of the ring before it wraps.
+struct RecordHeader {
+    const LogSite* site;
+    FormatFn format;
+    uint64_t ticks;
+    uint32_t size;      // whole record including header, multiple of RECORD_ALIGN
+    uint32_t reserved;
+};
+
+constexpr std::size_t RECORD_ALIGN = 8;
+
+inline std::size_t alignRecord(std::size_t size) {
+    return (size + RECORD_ALIGN - 1) & ~(RECORD_ALIGN - 1);
+}
+
+// How one argument type is stored in a record and rendered later. Types
+// without a specialization fail to compile at the call site.
+template <typename T, typename Enable = void>
+struct ArgCodec;
+
+template <typename T>
+struct ArgCodec<T, std::enable_if_t<std::is_arithmetic<T>::value>> {
+    using Decoded = T;
+
+    static std::size_t size(T) { return sizeof(T); }
+
+    static char* encode(char* dst, T value) {
+        std::memcpy(dst, &value, sizeof(T));
+        return dst + sizeof(T);
+    }
+
+    static const char* decode(const char* src, T& value) {
+        std::memcpy(&value, src, sizeof(T));
+        return src + sizeof(T);
+    }
+
+    static void append(std::string& out, T value) {
+        if constexpr (std::is_same<T, bool>::value) {
+            out += value ? "true" : "false";
+        } else if constexpr (std::is_same<T, char>::value) {
+            out.push_back(value);
+        } else {
+            // Shortest round-trip form for floating point; several times
+            // cheaper than printf's %g
+            char text[32];
+            auto result = std::to_chars(text, text + sizeof(text), value);
+            out.append(text, result.ptr);
+        }
+    }
+};
+
+// Strings are copied into the record (length-prefixed): the caller's buffer
+// may be gone by the time the background thread formats it
+struct StringArgCodec {
+    using Decoded = std::string_view;
+
+    static std::size_t size(std::string_view value) { return sizeof(uint32_t) + value.size(); }
+
+    static char* encode(char* dst, std::string_view value) {
+        uint32_t length = static_cast<uint32_t>(value.size());
+        std::memcpy(dst, &length, sizeof(length));
+        std::memcpy(dst + sizeof(length), value.data(), length);
+        return dst + sizeof(length) + length;
+    }
+
+    static const char* decode(const char* src, std::string_view& value) {
+        uint32_t length;
+        std::memcpy(&length, src, sizeof(length));
+        value = std::string_view(src + sizeof(length), length);
+        return src + sizeof(length) + length;
+    }
+
+    static void append(std::string& out, std::string_view value) { out.append(value.data(), value.size()); }
+};
+
+template <> struct ArgCodec<const char*> : StringArgCodec {};
+template <> struct ArgCodec<char*> : StringArgCodec {};
+template <> struct ArgCodec<std::string> : StringArgCodec {};
+template <> struct ArgCodec<std::string_view> : StringArgCodec {};
+
+template <typename T>
+using ArgCodecOf = ArgCodec<std::decay_t<T>>;
+
+template <typename... Args>
+std::size_t payloadSize(const Args&... args) {
+    return (std::size_t(0) + ... + ArgCodecOf<Args>::size(args));
+}
+
+template <typename... Args>
+char* encodeArgs(char* dst, const Args&... args) {
+    ((dst = ArgCodecOf<Args>::encode(dst, args)), ...);
+    return dst;
+}
+
+inline void appendFormatted(std::string& out, const char* format) {
+    out += format;
+}
+
+// Substitutes each "{}" in format with the next value; surplus values are
+// ignored and surplus placeholders are kept verbatim
+template <typename T, typename... Rest>
+void appendFormatted(std::string& out, const char* format, const T& value, const Rest&... rest) {
+    const char* placeholder = std::strstr(format, "{}");
+    if (placeholder == nullptr) {
+        out += format;
+        return;
+    }
+    out.append(format, placeholder);
+    ArgCodec<T>::append(out, value);
+    appendFormatted(out, placeholder + 2, rest...);
+}
+
+template <typename... Args, std::size_t... I>
+void formatDecoded(const LogSite& site, const char* args, std::string& out, std::index_sequence<I...>) {
+    std::tuple<typename ArgCodec<Args>::Decoded...> values;
+    ((args = ArgCodec<Args>::decode(args, std::get<I>(values))), ...);
+    (void)args;
+    appendFormatted(out, site.format, std::get<I>(values)...);
+}
+
+// Instantiated per argument-type list; its address travels in the record
+template <typename... Args>
+void formatRecord(const LogSite& site, const char* args, std::string& out) {
+    formatDecoded<Args...>(site, args, out, std::index_sequence_for<Args...>{});
+}
+
+} // namespace Record
@@ -0,0 +1,14 @@
+#include "ByteRing.hpp"
+
+namespace Ring {
+
+ByteRing::ByteRing(std::size_t requested)
+    : capacity(64), head(0), cachedTail(0), tail(0), cachedHead(0) {
+    while (capacity < requested) {
+        capacity <<= 1;
+    }
+    mask = capacity - 1;
+    buffer = std::make_unique<char[]>(capacity);
+}
+
+} // namespace Ring
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Ring {
+
+// Single-producer single-consumer ring of variable-length records.
+//
+// Positions are monotonically increasing byte counts; the producer owns
+// head, the consumer owns tail, and each caches the other's index so the
+// common case touches no shared cache line. A record is always contiguous:
+// if it does not fit before the end of the buffer the producer writes a
+// wrap marker (a zeroed first word) and continues at offset zero.
+class ByteRing {
+private:
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    std::unique_ptr<char[]> buffer;
+    std::size_t capacity;
+    std::size_t mask;
+
+    alignas(CACHE_LINE) std::atomic<uint64_t> head;
+    uint64_t cachedTail;
+
+    alignas(CACHE_LINE) std::atomic<uint64_t> tail;
+    uint64_t cachedHead;
+
+    bool hasRoom(uint64_t position, uint64_t size) {
+        if (position + size - cachedTail <= capacity) {
+            return true;
+        }
+        cachedTail = tail.load(std::memory_order_acquire);
+        return position + size - cachedTail <= capacity;
+    }
+
+public:
+    // capacity is rounded up to a power of two
+    explicit ByteRing(std::size_t capacity);
+
+    ByteRing(const ByteRing&) = delete;
+    ByteRing& operator=(const ByteRing&) = delete;
+
+    // Producer: contiguous space for size bytes (a multiple of 8, at most
+    // the capacity), or nullptr when the ring is full. Nothing is visible
+    // until commit().
+    char* reserve(std::size_t size) {
+        uint64_t position = head.load(std::memory_order_relaxed);
+        std::size_t offset = static_cast<std::size_t>(position & mask);
+        if (capacity - offset < size) {
+            // Publish the wrap marker on its own so the record can start at
+            // offset zero as soon as the consumer gets there
+            uint64_t skip = capacity - offset;
+            if (!hasRoom(position, skip)) {
+                return nullptr;
+            }
+            *reinterpret_cast<uint64_t*>(buffer.get() + offset) = 0;
+            position += skip;
+            head.store(position, std::memory_order_release);
+            offset = 0;
+        }
+        return hasRoom(position, size) ? buffer.get() + offset : nullptr;
+    }
+
+    void commit(std::size_t size) {
+        head.store(head.load(std::memory_order_relaxed) + size, std::memory_order_release);
+    }
+
+    // Consumer: start of the next unread byte and how many bytes up to the
+    // producer's head are readable without wrapping, refreshing the cached
+    // head only when the cached view is exhausted
+    const char* peek(std::size_t& available) {
+        uint64_t position = tail.load(std::memory_order_relaxed);
+        if (cachedHead == position) {
+            cachedHead = head.load(std::memory_order_acquire);
+        }
+        std::size_t offset = static_cast<std::size_t>(position & mask);
+        std::size_t pending = static_cast<std::size_t>(cachedHead - position);
+        available = pending < capacity - offset ? pending : capacity - offset;
+        return buffer.get() + offset;
+    }
+
+    // Consumer: skips to the start of the buffer after a wrap marker
+    void skipToStart() {
+        uint64_t position = tail.load(std::memory_order_relaxed);
+        tail.store(position + (capacity - (position & mask)), std::memory_order_release);
+    }
+
+    void release(std::size_t size) {
+        tail.store(tail.load(std::memory_order_relaxed) + size, std::memory_order_release);
+    }
+
+    bool empty() const {
+        return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire);
+    }
+
+    // Getters
+    std::size_t getCapacity() const { return capacity; }
+};
+
+} // namespace Ring
@@ -0,0 +1,17 @@
+#include "ConsoleSink.hpp"
+
+namespace Sinks {
+namespace ConcreteSinks {
+
+ConsoleSink::ConsoleSink(bool useStderr) : stream(useStderr ? stderr : stdout) {}
+
+void ConsoleSink::write(const char* data, std::size_t size) {
+    std::fwrite(data, 1, size, stream);
+}
+
+void ConsoleSink::flush() {
+    std::fflush(stream);
+}
+
+} // namespace ConcreteSinks
+} // namespace Sinks
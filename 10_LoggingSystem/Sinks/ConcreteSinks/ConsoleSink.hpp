@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdio>
+#include "Sinks/LogSink.hpp"
+
+namespace Sinks {
+namespace ConcreteSinks {
+
+// Writes to stdout or stderr through stdio
+class ConsoleSink : public LogSink {
+private:
+    std::FILE* stream;
+
+public:
+    explicit ConsoleSink(bool useStderr = false);
+
+    const char* getName() const override { return "CONSOLE"; }
+    void write(const char* data, std::size_t size) override;
+    void flush() override;
+};
+
+} // namespace ConcreteSinks
+} // namespace Sinks
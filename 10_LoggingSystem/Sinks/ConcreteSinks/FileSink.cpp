@@ -0,0 +1,28 @@
+#include "FileSink.hpp"
+#include <stdexcept>
+
+namespace Sinks {
+namespace ConcreteSinks {
+
+FileSink::FileSink(const std::string& path, bool truncate)
+    : path(path), file(std::fopen(path.c_str(), truncate ? "wb" : "ab")) {
+    if (file == nullptr) {
+        throw std::runtime_error("FileSink: cannot open " + path);
+    }
+    std::setvbuf(file, nullptr, _IONBF, 0);
+}
+
+FileSink::~FileSink() {
+    std::fclose(file);
+}
+
+void FileSink::write(const char* data, std::size_t size) {
+    std::fwrite(data, 1, size, file);
+}
+
+void FileSink::flush() {
+    std::fflush(file);
+}
+
+} // namespace ConcreteSinks
+} // namespace Sinks
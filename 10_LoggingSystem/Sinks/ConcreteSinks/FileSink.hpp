@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include "Sinks/LogSink.hpp"
+
+namespace Sinks {
+namespace ConcreteSinks {
+
+// Appends to a file. Batches already arrive large, so stdio buffering is
+// turned off and each batch is a single write.
+class FileSink : public LogSink {
+private:
+    std::string path;
+    std::FILE* file;
+
+public:
+    // Throws std::runtime_error if the file cannot be opened
+    explicit FileSink(const std::string& path, bool truncate = false);
+    ~FileSink() override;
+
+    FileSink(const FileSink&) = delete;
+    FileSink& operator=(const FileSink&) = delete;
+
+    const char* getName() const override { return "FILE"; }
+    void write(const char* data, std::size_t size) override;
+    void flush() override;
+
+    // Getters
+    const std::string& getPath() const { return path; }
+};
+
+} // namespace ConcreteSinks
+} // namespace Sinks
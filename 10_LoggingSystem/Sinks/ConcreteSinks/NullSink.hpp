@@ -0,0 +1,31 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include "Sinks/LogSink.hpp"
+
+namespace Sinks {
+namespace ConcreteSinks {
+
+// Discards output but counts it, to measure the logger without I/O
+class NullSink : public LogSink {
+private:
+    std::atomic<uint64_t> bytes;
+    std::atomic<uint64_t> writes;
+
+public:
+    NullSink() : bytes(0), writes(0) {}
+
+    const char* getName() const override { return "NULL"; }
+    void write(const char*, std::size_t size) override {
+        bytes.store(bytes.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+        writes.store(writes.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    // Getters
+    uint64_t getBytes() const { return bytes.load(std::memory_order_relaxed); }
+    uint64_t getWrites() const { return writes.load(std::memory_order_relaxed); }
+};
+
+} // namespace ConcreteSinks
+} // namespace Sinks
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Sinks {
+
+// Destination for formatted log output. Only the logger's background
+// thread calls a sink, always with whole lines batched together.
+class LogSink {
+public:
+    virtual ~LogSink() = default;
+
+    virtual const char* getName() const = 0;
+    virtual void write(const char* data, std::size_t size) = 0;
+    virtual void flush() {}
+};
+
+} // namespace Sinks
@@ -0,0 +1,25 @@
+#include "TickClock.hpp"
+#include <thread>
+
+namespace Utility {
+
+namespace {
+
+int64_t epochNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+}
+
+TickConverter::TickConverter(std::chrono::milliseconds calibration) {
+    baseTicks = readTicks();
+    baseEpochNanos = epochNanos();
+    std::this_thread::sleep_for(calibration);
+    uint64_t endTicks = readTicks();
+    int64_t endNanos = epochNanos();
+    nanosPerTick = endTicks > baseTicks
+                 ? static_cast<double>(endNanos - baseEpochNanos) / static_cast<double>(endTicks - baseTicks) : 1.0;
+}
+
+} // namespace Utility
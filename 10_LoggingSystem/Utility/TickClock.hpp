@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace Utility {
+
+// Timestamp for the hot path: the invariant TSC on x86, steady_clock
+// elsewhere. Ticks are only turned into wall time on the background thread.
+inline uint64_t readTicks() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+// Maps ticks to nanoseconds since the epoch, calibrated against
+// system_clock when constructed
+class TickConverter {
+private:
+    double nanosPerTick;
+    uint64_t baseTicks;
+    int64_t baseEpochNanos;
+
+public:
+    explicit TickConverter(std::chrono::milliseconds calibration = std::chrono::milliseconds(20));
+
+    int64_t toEpochNanos(uint64_t ticks) const {
+        return baseEpochNanos + static_cast<int64_t>((static_cast<double>(ticks) - static_cast<double>(baseTicks)) * nanosPerTick);
+    }
+    double getNanosPerTick() const { return nanosPerTick; }
+};
+
+} // namespace Utility
@@ -0,0 +1,42 @@
+#include "Controller/LogMacros.hpp"
+#include "Benchmark/LoggerBenchmark.hpp"
+#include "Sinks/ConcreteSinks/ConsoleSink.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    std::cout << "Logging System Implementation" << std::endl;
+
+    {
+        Controller::LoggerConfig config;
+        config.level = CommonEnum::LogLevel::INFO;
+        Controller::Logger logger({std::make_shared<Sinks::ConcreteSinks::ConsoleSink>()}, config);
+        std::string user = "alice";
+        LOG_INFO(logger, "user {} logged in from {} (attempt {})", user, "10.0.0.7", 1);
+        LOG_DEBUG(logger, "filtered at runtime: level is {}", CommonEnum::logLevelToString(logger.getLevel()));
+        logger.setLevel(CommonEnum::LogLevel::DEBUG);
+        LOG_DEBUG(logger, "cache hit ratio {} after {} lookups", 0.93, 4096u);
+        LOG_WARN(logger, "disk {} is {}% full", "/var", 91);
+        LOG_ERROR(logger, "no arguments, just text");
+        logger.flush();
+    }
+
+    // Producer-side cost and end-to-end throughput against synchronous
+    // std::cout; output goes to /dev/null unless a path is given
+    uint64_t perThread = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    std::string path = argc > 2 ? argv[2] : "/dev/null";
+
+    Controller::LoggerConfig block;
+    block.overflowPolicy = CommonEnum::OverflowPolicy::BLOCK;
+    Controller::LoggerConfig drop;
+    drop.overflowPolicy = CommonEnum::OverflowPolicy::DROP;
+
+    std::cout << "\nLogging " << perThread << " messages per thread to " << path << std::endl;
+    for (int threads : {1, 4}) {
+        Benchmark::printResult(Benchmark::runCoutLogging(threads, perThread, path));
+        Benchmark::printResult(Benchmark::runAsyncLogging("async BLOCK 1MiB", block, threads, perThread, path));
+        Benchmark::printResult(Benchmark::runAsyncLogging("async DROP 1MiB", drop, threads, perThread, path));
+    }
+    return 0;
+}
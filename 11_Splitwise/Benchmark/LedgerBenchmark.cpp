@@ -0,0 +1,84 @@
+#include "LedgerBenchmark.hpp"
+#include <chrono>
+
+namespace Benchmark {
+
+std::vector<Utility::Expense> generateExpenses(const std::vector<uint32_t>& userIds, std::size_t count,
+                                               std::mt19937_64& rng) {
+    std::uniform_int_distribution<std::size_t> pickUser(0, userIds.size() - 1);
+    std::uniform_int_distribution<int> pickSize(2, 8);
+    std::uniform_int_distribution<Utility::Cents> pickAmount(100, 50000);
+    std::uniform_int_distribution<int> pickType(0, 99);
+    std::uniform_int_distribution<int64_t> pickWeight(1, 5);
+
+    std::vector<Utility::Expense> expenses(count);
+    for (auto& expense : expenses) {
+        int size = pickSize(rng);
+        expense.payer = userIds[pickUser(rng)];
+        expense.amount = pickAmount(rng);
+        expense.participants.reserve(size);
+        for (int i = 0; i < size; ++i) {
+            expense.participants.push_back(userIds[pickUser(rng)]);
+        }
+
+        int type = pickType(rng);
+        if (type < 60) {
+            expense.splitType = CommonEnum::SplitType::EQUAL;
+        } else if (type < 75) {
+            expense.splitType = CommonEnum::SplitType::EXACT;
+            Utility::Cents remaining = expense.amount;
+            for (int i = 0; i < size; ++i) {
+                Utility::Cents share = i + 1 == size ? remaining : remaining / 2;
+                expense.values.push_back(share);
+                remaining -= share;
+            }
+        } else if (type < 90) {
+            expense.splitType = CommonEnum::SplitType::PERCENT;
+            int64_t remaining = 10000;
+            for (int i = 0; i < size; ++i) {
+                int64_t points = i + 1 == size ? remaining : remaining / (size - i);
+                expense.values.push_back(points);
+                remaining -= points;
+            }
+        } else {
+            expense.splitType = CommonEnum::SplitType::SHARES;
+            for (int i = 0; i < size; ++i) {
+                expense.values.push_back(pickWeight(rng));
+            }
+        }
+    }
+    return expenses;
+}
+
+BatchResult runBatch(Controller::Splitwise& splitwise, uint32_t groupId, const std::vector<Utility::Expense>& expenses) {
+    BatchResult result{};
+    auto start = std::chrono::steady_clock::now();
+    result.applied = splitwise.addExpenses(groupId, expenses);
+    auto applied = std::chrono::steady_clock::now();
+    result.transfers = splitwise.simplify(groupId).size();
+    auto simplified = std::chrono::steady_clock::now();
+    result.applySeconds = std::chrono::duration<double>(applied - start).count();
+    result.simplifySeconds = std::chrono::duration<double>(simplified - applied).count();
+    for (Utility::Cents balance : splitwise.getLedger(groupId).getBalances()) {
+        result.openBalances += balance != 0 ? 1 : 0;
+    }
+    return result;
+}
+
+bool verifySettlement(Controller::Splitwise& splitwise, uint32_t groupId) {
+    std::vector<Utility::Transfer> plan = splitwise.simplify(groupId);
+    for (const auto& transfer : plan) {
+        if (splitwise.recordPayment(groupId, transfer.from, transfer.to, transfer.amount)
+                != CommonEnum::ExpenseStatus::SUCCESS) {
+            return false;
+        }
+    }
+    for (Utility::Cents balance : splitwise.getLedger(groupId).getBalances()) {
+        if (balance != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace Benchmark
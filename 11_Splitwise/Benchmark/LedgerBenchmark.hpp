@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "Controller/Splitwise.hpp"
+
+namespace Benchmark {
+
+struct BatchResult {
+    std::size_t applied;
+    double applySeconds;
+    double simplifySeconds;
+    std::size_t transfers;
+    std::size_t openBalances;   // members with a non-zero balance
+
+    double expensesPerSecond() const { return applySeconds > 0 ? applied / applySeconds : 0.0; }
+};
+
+// Random expenses among userIds: 2-8 participants, mostly EQUAL splits
+// with some EXACT, PERCENT and SHARES
+std::vector<Utility::Expense> generateExpenses(const std::vector<uint32_t>& userIds, std::size_t count,
+                                               std::mt19937_64& rng);
+
+// Applies the batch to the group and re-simplifies its debts
+BatchResult runBatch(Controller::Splitwise& splitwise, uint32_t groupId, const std::vector<Utility::Expense>& expenses);
+
+// Pays out the current plan and checks that every balance ends at zero
+bool verifySettlement(Controller::Splitwise& splitwise, uint32_t groupId);
+
+} // namespace Benchmark
@@ -0,0 +1,37 @@
+#include "SplitType.hpp"
+
+namespace CommonEnum {
+
+const char* splitTypeToString(SplitType type) {
+    switch (type) {
+        case SplitType::EQUAL:
+            return "EQUAL";
+        case SplitType::EXACT:
+            return "EXACT";
+        case SplitType::PERCENT:
+            return "PERCENT";
+        case SplitType::SHARES:
+            return "SHARES";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+const char* expenseStatusToString(ExpenseStatus status) {
+    switch (status) {
+        case ExpenseStatus::SUCCESS:
+            return "SUCCESS";
+        case ExpenseStatus::UNKNOWN_GROUP:
+            return "UNKNOWN_GROUP";
+        case ExpenseStatus::UNKNOWN_USER:
+            return "UNKNOWN_USER";
+        case ExpenseStatus::INVALID_AMOUNT:
+            return "INVALID_AMOUNT";
+        case ExpenseStatus::INVALID_SPLIT:
+            return "INVALID_SPLIT";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+} // namespace CommonEnum
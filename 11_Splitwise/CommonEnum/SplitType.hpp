@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CommonEnum {
+
+enum class SplitType : uint8_t {
+    EQUAL,      // amount divided evenly, leftover cents to the first participants
+    EXACT,      // values are cents and must add up to the amount
+    PERCENT,    // values are basis points and must add up to 10000
+    SHARES      // values are relative weights
+};
+
+enum class ExpenseStatus {
+    SUCCESS,
+    UNKNOWN_GROUP,
+    UNKNOWN_USER,
+    INVALID_AMOUNT,
+    INVALID_SPLIT
+};
+
+// Utility functions for expense enums
+const char* splitTypeToString(SplitType type);
+const char* expenseStatusToString(ExpenseStatus status);
+
+} // namespace CommonEnum
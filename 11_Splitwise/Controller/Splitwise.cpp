@@ -0,0 +1,130 @@
+#include "Splitwise.hpp"
+#include <stdexcept>
+
+namespace Controller {
+
+Splitwise::Group* Splitwise::findGroup(uint32_t groupId) const {
+    return groupId < groups.size() ? groups[groupId].get() : nullptr;
+}
+
+uint32_t Splitwise::addUser(const std::string& name) {
+    auto found = userIds.find(name);
+    if (found != userIds.end()) {
+        return found->second;
+    }
+    uint32_t id = static_cast<uint32_t>(userNames.size());
+    userNames.push_back(name);
+    userIds.emplace(name, id);
+    return id;
+}
+
+uint32_t Splitwise::createGroup(const std::string& name, const std::vector<uint32_t>& members) {
+    uint32_t groupId = static_cast<uint32_t>(groups.size());
+    groups.push_back(std::make_unique<Group>(name));
+    groups.back()->slotOf.reserve(members.size());
+    for (uint32_t userId : members) {
+        addMember(groupId, userId);
+    }
+    return groupId;
+}
+
+CommonEnum::ExpenseStatus Splitwise::addMember(uint32_t groupId, uint32_t userId) {
+    Group* group = findGroup(groupId);
+    if (group == nullptr) {
+        return CommonEnum::ExpenseStatus::UNKNOWN_GROUP;
+    }
+    if (userId >= userNames.size()) {
+        return CommonEnum::ExpenseStatus::UNKNOWN_USER;
+    }
+    if (group->slotOf.count(userId) == 0) {
+        group->slotOf.emplace(userId, group->ledger.addMember());
+        group->members.push_back(userId);
+    }
+    return CommonEnum::ExpenseStatus::SUCCESS;
+}
+
+CommonEnum::ExpenseStatus Splitwise::addExpense(uint32_t groupId, const Utility::Expense& expense) {
+    Group* group = findGroup(groupId);
+    if (group == nullptr) {
+        return CommonEnum::ExpenseStatus::UNKNOWN_GROUP;
+    }
+    if (expense.splitType != CommonEnum::SplitType::EQUAL && expense.values.size() != expense.participants.size()) {
+        return CommonEnum::ExpenseStatus::INVALID_SPLIT;
+    }
+    auto payer = group->slotOf.find(expense.payer);
+    if (payer == group->slotOf.end()) {
+        return CommonEnum::ExpenseStatus::UNKNOWN_USER;
+    }
+    group->slotScratch.clear();
+    for (uint32_t userId : expense.participants) {
+        auto slot = group->slotOf.find(userId);
+        if (slot == group->slotOf.end()) {
+            return CommonEnum::ExpenseStatus::UNKNOWN_USER;
+        }
+        group->slotScratch.push_back(slot->second);
+    }
+    return group->ledger.apply(payer->second, expense.amount, expense.splitType, group->slotScratch.data(),
+                               expense.values.data(), group->slotScratch.size());
+}
+
+std::size_t Splitwise::addExpenses(uint32_t groupId, const std::vector<Utility::Expense>& expenses) {
+    std::size_t applied = 0;
+    for (const auto& expense : expenses) {
+        if (addExpense(groupId, expense) == CommonEnum::ExpenseStatus::SUCCESS) {
+            ++applied;
+        }
+    }
+    return applied;
+}
+
+CommonEnum::ExpenseStatus Splitwise::recordPayment(uint32_t groupId, uint32_t from, uint32_t to, Utility::Cents amount) {
+    Group* group = findGroup(groupId);
+    if (group == nullptr) {
+        return CommonEnum::ExpenseStatus::UNKNOWN_GROUP;
+    }
+    if (amount <= 0 || amount > Utility::MAX_EXPENSE) {
+        return CommonEnum::ExpenseStatus::INVALID_AMOUNT;
+    }
+    auto fromSlot = group->slotOf.find(from);
+    auto toSlot = group->slotOf.find(to);
+    if (fromSlot == group->slotOf.end() || toSlot == group->slotOf.end()) {
+        return CommonEnum::ExpenseStatus::UNKNOWN_USER;
+    }
+    group->ledger.settle(fromSlot->second, toSlot->second, amount);
+    return CommonEnum::ExpenseStatus::SUCCESS;
+}
+
+const std::vector<Utility::Transfer>& Splitwise::simplify(uint32_t groupId) {
+    Group* group = findGroup(groupId);
+    if (group == nullptr) {
+        throw std::out_of_range("Splitwise: unknown group");
+    }
+    if (group->planVersion != group->ledger.getVersion()) {
+        simplifier.simplify(group->ledger.getBalances(), group->plan);
+        for (auto& transfer : group->plan) {
+            transfer.from = group->members[transfer.from];
+            transfer.to = group->members[transfer.to];
+        }
+        group->planVersion = group->ledger.getVersion();
+    }
+    return group->plan;
+}
+
+Utility::Cents Splitwise::getBalance(uint32_t groupId, uint32_t userId) const {
+    Group* group = findGroup(groupId);
+    if (group == nullptr) {
+        return 0;
+    }
+    auto slot = group->slotOf.find(userId);
+    return slot == group->slotOf.end() ? 0 : group->ledger.getBalance(slot->second);
+}
+
+const Ledger::BalanceLedger& Splitwise::getLedger(uint32_t groupId) const {
+    Group* group = findGroup(groupId);
+    if (group == nullptr) {
+        throw std::out_of_range("Splitwise: unknown group");
+    }
+    return group->ledger;
+}
+
+} // namespace Controller
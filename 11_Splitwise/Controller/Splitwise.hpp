@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "CommonEnum/SplitType.hpp"
+#include "Ledger/BalanceLedger.hpp"
+#include "Settlement/DebtSimplifier.hpp"
+#include "Utility/Expense.hpp"
+
+namespace Controller {
+
+// Users, groups and their ledgers. Each group numbers its members with
+// dense slots so its balances live in one flat array; user ids are mapped
+// to slots once per participant when an expense is applied.
+class Splitwise {
+private:
+    struct Group {
+        std::string name;
+        std::vector<uint32_t> members;                  // slot -> user id
+        std::unordered_map<uint32_t, uint32_t> slotOf;  // user id -> slot
+        Ledger::BalanceLedger ledger;
+        std::vector<uint32_t> slotScratch;
+        std::vector<Utility::Transfer> plan;            // by user id, valid for planVersion
+        uint64_t planVersion;
+
+        explicit Group(const std::string& name) : name(name), planVersion(UINT64_MAX) {}
+    };
+
+    std::vector<std::string> userNames;
+    std::unordered_map<std::string, uint32_t> userIds;
+    std::vector<std::unique_ptr<Group>> groups;
+    Settlement::DebtSimplifier simplifier;
+
+    Group* findGroup(uint32_t groupId) const;
+
+public:
+    // Returns the existing id if the name is already registered
+    uint32_t addUser(const std::string& name);
+    uint32_t createGroup(const std::string& name, const std::vector<uint32_t>& members);
+    CommonEnum::ExpenseStatus addMember(uint32_t groupId, uint32_t userId);
+
+    CommonEnum::ExpenseStatus addExpense(uint32_t groupId, const Utility::Expense& expense);
+    // Applies a batch; returns how many succeeded (failed ones change nothing)
+    std::size_t addExpenses(uint32_t groupId, const std::vector<Utility::Expense>& expenses);
+    // Records a repayment outside of any expense
+    CommonEnum::ExpenseStatus recordPayment(uint32_t groupId, uint32_t from, uint32_t to, Utility::Cents amount);
+
+    // Minimum-transfer plan for the group's current balances; recomputed
+    // only when the ledger changed since the last call.
+    // Throws std::out_of_range for an unknown group.
+    const std::vector<Utility::Transfer>& simplify(uint32_t groupId);
+
+    // Getters
+    Utility::Cents getBalance(uint32_t groupId, uint32_t userId) const;
+    const std::string& getUserName(uint32_t userId) const { return userNames.at(userId); }
+    std::size_t getUserCount() const { return userNames.size(); }
+    const Ledger::BalanceLedger& getLedger(uint32_t groupId) const;
+};
+
+} // namespace Controller
@@ -0,0 +1,115 @@
+#include "BalanceLedger.hpp"
+#include <algorithm>
+
+namespace Ledger {
+
+BalanceLedger::BalanceLedger() : expenseCount(0), version(0) {}
+
+uint32_t BalanceLedger::addMember() {
+    balances.push_back(0);
+    return static_cast<uint32_t>(balances.size() - 1);
+}
+
+void BalanceLedger::allocate(Utility::Cents amount, const int64_t* weights, std::size_t count, int64_t totalWeight) {
+    Utility::Cents assigned = 0;
+    bool exact = true;
+    for (std::size_t i = 0; i < count; ++i) {
+        // MAX_EXPENSE times a 31-bit weight can exceed int64
+        __int128 scaled = static_cast<__int128>(amount) * weights[i];
+        shares[i] = static_cast<Utility::Cents>(scaled / totalWeight);
+        exact = exact && scaled % totalWeight == 0;
+        assigned += shares[i];
+    }
+    Utility::Cents leftover = amount - assigned;
+    if (leftover == 0 || exact) {
+        return;
+    }
+    remainderOrder.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        remainderOrder[i] = static_cast<uint32_t>(i);
+    }
+    auto remainder = [&](uint32_t i) {
+        return static_cast<int64_t>(static_cast<__int128>(amount) * weights[i] % totalWeight);
+    };
+    std::stable_sort(remainderOrder.begin(), remainderOrder.end(),
+                     [&](uint32_t a, uint32_t b) { return remainder(a) > remainder(b); });
+    for (Utility::Cents i = 0; i < leftover; ++i) {
+        ++shares[remainderOrder[static_cast<std::size_t>(i)]];
+    }
+}
+
+CommonEnum::ExpenseStatus BalanceLedger::apply(uint32_t payerSlot, Utility::Cents amount, CommonEnum::SplitType splitType,
+                                               const uint32_t* slots, const int64_t* values, std::size_t count) {
+    if (amount <= 0 || amount > Utility::MAX_EXPENSE) {
+        return CommonEnum::ExpenseStatus::INVALID_AMOUNT;
+    }
+    if (count == 0 || payerSlot >= balances.size()) {
+        return CommonEnum::ExpenseStatus::INVALID_SPLIT;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        if (slots[i] >= balances.size()) {
+            return CommonEnum::ExpenseStatus::UNKNOWN_USER;
+        }
+    }
+
+    shares.resize(count);
+    switch (splitType) {
+        case CommonEnum::SplitType::EQUAL: {
+            Utility::Cents base = amount / static_cast<Utility::Cents>(count);
+            std::size_t extra = static_cast<std::size_t>(amount % static_cast<Utility::Cents>(count));
+            for (std::size_t i = 0; i < count; ++i) {
+                shares[i] = base + (i < extra ? 1 : 0);
+            }
+            break;
+        }
+        case CommonEnum::SplitType::EXACT: {
+            Utility::Cents total = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                // Checked against what is left so the running total never
+                // passes amount and cannot overflow
+                if (values[i] < 0 || values[i] > amount - total) {
+                    return CommonEnum::ExpenseStatus::INVALID_SPLIT;
+                }
+                shares[i] = values[i];
+                total += values[i];
+            }
+            if (total != amount) {
+                return CommonEnum::ExpenseStatus::INVALID_SPLIT;
+            }
+            break;
+        }
+        case CommonEnum::SplitType::PERCENT:
+        case CommonEnum::SplitType::SHARES: {
+            int64_t totalWeight = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                if (values[i] < 0 || values[i] > INT32_MAX) {
+                    return CommonEnum::ExpenseStatus::INVALID_SPLIT;
+                }
+                totalWeight += values[i];
+            }
+            if (totalWeight == 0 || (splitType == CommonEnum::SplitType::PERCENT && totalWeight != 10000)) {
+                return CommonEnum::ExpenseStatus::INVALID_SPLIT;
+            }
+            allocate(amount, values, count, totalWeight);
+            break;
+        }
+        default:
+            return CommonEnum::ExpenseStatus::INVALID_SPLIT;
+    }
+
+    balances[payerSlot] += amount;
+    for (std::size_t i = 0; i < count; ++i) {
+        balances[slots[i]] -= shares[i];
+    }
+    ++expenseCount;
+    ++version;
+    return CommonEnum::ExpenseStatus::SUCCESS;
+}
+
+void BalanceLedger::settle(uint32_t fromSlot, uint32_t toSlot, Utility::Cents amount) {
+    balances[fromSlot] += amount;
+    balances[toSlot] -= amount;
+    ++version;
+}
+
+} // namespace Ledger
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CommonEnum/SplitType.hpp"
+#include "Utility/Money.hpp"
+
+namespace Ledger {
+
+// Net balance of every member of a group, one int64 of cents per member
+// slot in a flat array. An expense touches only its payer and participants,
+// so applying it costs O(participants) no matter how large the group or
+// how long its history. Positive means the member is owed money.
+class BalanceLedger {
+private:
+    std::vector<Utility::Cents> balances;
+    std::vector<Utility::Cents> shares;       // scratch for the split being applied
+    std::vector<uint32_t> remainderOrder;     // scratch for largest-remainder rounding
+    uint64_t expenseCount;
+    uint64_t version;                         // bumped by every change to balances
+
+    // Splits amount in proportion to weights; shares sum to amount exactly,
+    // leftover cents going to the largest fractional remainders
+    void allocate(Utility::Cents amount, const int64_t* weights, std::size_t count, int64_t totalWeight);
+
+public:
+    BalanceLedger();
+
+    uint32_t addMember();
+
+    // Validates the split, then applies it; nothing changes on failure
+    CommonEnum::ExpenseStatus apply(uint32_t payerSlot, Utility::Cents amount, CommonEnum::SplitType splitType,
+                                    const uint32_t* slots, const int64_t* values, std::size_t count);
+
+    // Records a settlement payment from one member to another
+    void settle(uint32_t fromSlot, uint32_t toSlot, Utility::Cents amount);
+
+    // Getters
+    std::size_t getMemberCount() const { return balances.size(); }
+    Utility::Cents getBalance(uint32_t slot) const { return balances[slot]; }
+    const std::vector<Utility::Cents>& getBalances() const { return balances; }
+    uint64_t getExpenseCount() const { return expenseCount; }
+    uint64_t getVersion() const { return version; }
+};
+
+} // namespace Ledger
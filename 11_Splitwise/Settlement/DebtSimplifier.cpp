@@ -0,0 +1,43 @@
+#include "DebtSimplifier.hpp"
+#include <algorithm>
+
+namespace Settlement {
+
+void DebtSimplifier::simplify(const std::vector<Utility::Cents>& balances, std::vector<Utility::Transfer>& plan) {
+    plan.clear();
+    creditors.clear();
+    debtors.clear();
+    for (std::size_t slot = 0; slot < balances.size(); ++slot) {
+        if (balances[slot] > 0) {
+            creditors.emplace_back(balances[slot], static_cast<uint32_t>(slot));
+        } else if (balances[slot] < 0) {
+            debtors.emplace_back(-balances[slot], static_cast<uint32_t>(slot));
+        }
+    }
+    std::make_heap(creditors.begin(), creditors.end());
+    std::make_heap(debtors.begin(), debtors.end());
+
+    while (!creditors.empty() && !debtors.empty()) {
+        std::pop_heap(creditors.begin(), creditors.end());
+        std::pop_heap(debtors.begin(), debtors.end());
+        Entry& creditor = creditors.back();
+        Entry& debtor = debtors.back();
+        Utility::Cents amount = std::min(creditor.first, debtor.first);
+        plan.push_back({debtor.second, creditor.second, amount});
+
+        creditor.first -= amount;
+        debtor.first -= amount;
+        if (creditor.first > 0) {
+            std::push_heap(creditors.begin(), creditors.end());
+        } else {
+            creditors.pop_back();
+        }
+        if (debtor.first > 0) {
+            std::push_heap(debtors.begin(), debtors.end());
+        } else {
+            debtors.pop_back();
+        }
+    }
+}
+
+} // namespace Settlement
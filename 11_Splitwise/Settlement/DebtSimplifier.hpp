@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Utility/Expense.hpp"
+
+namespace Settlement {
+
+// Minimum-transfer settlement plan from net balances. Creditors and debtors
+// are kept in two max-heaps; each step matches the largest creditor with
+// the largest debtor and settles the smaller of the two amounts, so every
+// transfer retires at least one member: at most n - 1 transfers in
+// O(n log n). (A truly minimal plan is NP-hard; greedy is the standard
+// approximation.) Heaps are built in O(n) and their storage is reused, so
+// re-simplifying after each batch of expenses does not allocate.
+class DebtSimplifier {
+private:
+    using Entry = std::pair<Utility::Cents, uint32_t>;   // amount, slot
+
+    std::vector<Entry> creditors;
+    std::vector<Entry> debtors;
+
+public:
+    // Appends transfers between slots to plan (cleared first)
+    void simplify(const std::vector<Utility::Cents>& balances, std::vector<Utility::Transfer>& plan);
+};
+
+} // namespace Settlement
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "CommonEnum/SplitType.hpp"
+#include "Utility/Money.hpp"
+
+namespace Utility {
+
+struct Expense {
+    uint32_t payer;
+    Cents amount;
+    CommonEnum::SplitType splitType;
+    std::vector<uint32_t> participants;   // user ids, may include the payer
+    std::vector<int64_t> values;          // per participant; unused for EQUAL
+};
+
+struct Transfer {
+    uint32_t from;
+    uint32_t to;
+    Cents amount;
+};
+
+} // namespace Utility
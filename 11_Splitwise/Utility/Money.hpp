@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+namespace Utility {
+
+// All amounts are integer cents: splitting never loses or invents money
+using Cents = int64_t;
+
+// Largest single expense accepted, so weighted splits cannot overflow
+constexpr Cents MAX_EXPENSE = 1000000000000LL;   // ten billion units
+
+inline std::string formatCents(Cents amount) {
+    std::string text = amount < 0 ? "-" : "";
+    Cents magnitude = std::llabs(amount);
+    text += std::to_string(magnitude / 100);
+    text += '.';
+    text += static_cast<char>('0' + magnitude % 100 / 10);
+    text += static_cast<char>('0' + magnitude % 10);
+    return text;
+}
+
+} // namespace Utility
@@ -0,0 +1,68 @@
+#include "Controller/Splitwise.hpp"
+#include "Benchmark/LedgerBenchmark.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+int main(int argc, char* argv[]) {
+    std::cout << "Splitwise Implementation" << std::endl;
+
+    Controller::Splitwise splitwise;
+    uint32_t alice = splitwise.addUser("alice");
+    uint32_t bob = splitwise.addUser("bob");
+    uint32_t carol = splitwise.addUser("carol");
+    uint32_t dave = splitwise.addUser("dave");
+    uint32_t trip = splitwise.createGroup("trip", {alice, bob, carol, dave});
+
+    splitwise.addExpense(trip, {alice, 10000, CommonEnum::SplitType::EQUAL, {alice, bob, carol}, {}});
+    splitwise.addExpense(trip, {bob, 4000, CommonEnum::SplitType::EXACT, {carol, dave}, {1500, 2500}});
+    splitwise.addExpense(trip, {dave, 9999, CommonEnum::SplitType::PERCENT, {alice, bob, carol, dave}, {2500, 2500, 2500, 2500}});
+    splitwise.addExpense(trip, {carol, 700, CommonEnum::SplitType::SHARES, {alice, dave}, {2, 1}});
+    std::cout << "Bad split: " << CommonEnum::expenseStatusToString(
+        splitwise.addExpense(trip, {carol, 700, CommonEnum::SplitType::EXACT, {alice, dave}, {100, 100}})) << std::endl;
+    // Shares that would wrap around to the amount if summed blindly
+    std::cout << "Overflowing split: " << CommonEnum::expenseStatusToString(
+        splitwise.addExpense(trip, {carol, 700, CommonEnum::SplitType::EXACT, {alice, bob, dave},
+                                    {INT64_MAX, INT64_MAX, 702}})) << std::endl;
+
+    for (uint32_t user : {alice, bob, carol, dave}) {
+        std::cout << "  " << splitwise.getUserName(user) << " "
+                  << Utility::formatCents(splitwise.getBalance(trip, user)) << std::endl;
+    }
+    for (const auto& transfer : splitwise.simplify(trip)) {
+        std::cout << "  " << splitwise.getUserName(transfer.from) << " pays " << splitwise.getUserName(transfer.to)
+                  << " " << Utility::formatCents(transfer.amount) << std::endl;
+    }
+
+    // Large group: default 1M expenses across 10k users, re-simplified
+    // after every batch of 100k
+    std::size_t users = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+    std::size_t expenses = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000000;
+    std::size_t batchSize = 100000;
+
+    Controller::Splitwise large;
+    std::vector<uint32_t> userIds;
+    for (std::size_t i = 0; i < users; ++i) {
+        userIds.push_back(large.addUser("user" + std::to_string(i)));
+    }
+    uint32_t group = large.createGroup("company", userIds);
+    std::mt19937_64 rng(42);
+
+    std::cout << "\n" << expenses << " expenses across " << users << " users" << std::endl;
+    double applySeconds = 0;
+    double simplifySeconds = 0;
+    for (std::size_t done = 0; done < expenses; done += batchSize) {
+        auto batch = Benchmark::generateExpenses(userIds, std::min(batchSize, expenses - done), rng);
+        Benchmark::BatchResult result = Benchmark::runBatch(large, group, batch);
+        applySeconds += result.applySeconds;
+        simplifySeconds += result.simplifySeconds;
+        std::printf("  batch %2zu: %zu applied at %.2fM/s, simplify %.2f ms -> %zu transfers for %zu open balances\n",
+                    done / batchSize + 1, result.applied, result.expensesPerSecond() / 1e6,
+                    result.simplifySeconds * 1e3, result.transfers, result.openBalances);
+    }
+    std::printf("Total: apply %.3fs (%.2fM expenses/s), simplify %.3fs\n", applySeconds,
+                expenses / applySeconds / 1e6, simplifySeconds);
+    std::cout << "Plan settles every balance: " << (Benchmark::verifySettlement(large, group) ? "yes" : "no") << std::endl;
+    return 0;
+}
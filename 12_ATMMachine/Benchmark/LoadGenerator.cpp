@@ -0,0 +1,83 @@
+#include "LoadGenerator.hpp"
+#include "Controller/ATMTerminal.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace Benchmark {
+
+LoadResult runLoad(Controller::Bank& bank, int terminals, uint64_t transactionsPerTerminal, uint32_t accounts) {
+    std::vector<std::vector<uint32_t>> latencies(terminals);  // nanoseconds, preallocated per thread
+    std::atomic<uint64_t> succeeded{0};
+    std::atomic<bool> start{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < terminals; t++) {
+        latencies[t].reserve(transactionsPerTerminal);
+        threads.emplace_back([&, t]() {
+            Controller::ATMTerminal terminal(t, bank, Utility::CashDispenser({10000, 5000, 2000, 1000},
+                                                                             {1000000, 1000000, 1000000, 1000000}));
+            std::mt19937_64 rng(t + 7);
+            std::uniform_int_distribution<uint32_t> account(0, accounts - 1);
+            std::uniform_int_distribution<int> kind(0, 9);
+            std::uniform_int_distribution<int64_t> notes(1, 30);
+            uint64_t ok = 0;
+
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (uint64_t i = 0; i < transactionsPerTerminal; i++) {
+                int roll = kind(rng);
+                int64_t amount = notes(rng) * 1000;  // multiples of $10
+                auto begin = std::chrono::steady_clock::now();
+                CommonEnum::TransactionStatus status;
+                if (roll < 5) {
+                    status = terminal.withdraw(account(rng), amount);
+                } else if (roll < 8) {
+                    status = terminal.deposit(account(rng), amount);
+                } else {
+                    status = terminal.transfer(account(rng), account(rng), amount);
+                }
+                auto end = std::chrono::steady_clock::now();
+                latencies[t].push_back(static_cast<uint32_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()));
+                if (status == CommonEnum::TransactionStatus::SUCCESS) {
+                    ok++;
+                }
+            }
+            succeeded += ok;
+        });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    std::vector<uint32_t> all;
+    for (auto& perThread : latencies) {
+        all.insert(all.end(), perThread.begin(), perThread.end());
+    }
+    LoadResult result;
+    result.transactions = all.size();
+    result.succeeded = succeeded.load();
+    result.seconds = std::chrono::duration<double>(end - begin).count();
+    if (!all.empty()) {
+        auto percentile = [&all](double p) {
+            std::size_t index = std::min(all.size() - 1, static_cast<std::size_t>(p / 100.0 * all.size()));
+            std::nth_element(all.begin(), all.begin() + index, all.end());
+            return all[index] / 1000.0;
+        };
+        result.p50Micros = percentile(50);
+        result.p99Micros = percentile(99);
+        result.maxMicros = *std::max_element(all.begin(), all.end()) / 1000.0;
+    }
+    return result;
+}
+
+} // namespace Benchmark
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include "Controller/Bank.hpp"
+
+namespace Benchmark {
+
+struct LoadResult {
+    uint64_t transactions = 0;
+    uint64_t succeeded = 0;
+    double seconds = 0.0;
+    double p50Micros = 0.0;
+    double p99Micros = 0.0;
+    double maxMicros = 0.0;
+
+    double transactionsPerSecond() const { return seconds > 0 ? transactions / seconds : 0.0; }
+};
+
+// Runs `terminals` ATM threads against the bank, each issuing a mix of
+// withdrawals, deposits and transfers over random accounts, and measures
+// per-transaction latency including the wait for the durable commit.
+LoadResult runLoad(Controller::Bank& bank, int terminals, uint64_t transactionsPerTerminal, uint32_t accounts);
+
+} // namespace Benchmark
@@ -0,0 +1,39 @@
+#include "TransactionType.hpp"
+
+namespace CommonEnum {
+
+const char* transactionTypeToString(TransactionType type) {
+    switch (type) {
+        case TransactionType::OPEN_ACCOUNT:
+            return "OPEN_ACCOUNT";
+        case TransactionType::DEPOSIT:
+            return "DEPOSIT";
+        case TransactionType::WITHDRAW:
+            return "WITHDRAW";
+        case TransactionType::TRANSFER:
+            return "TRANSFER";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+const char* transactionStatusToString(TransactionStatus status) {
+    switch (status) {
+        case TransactionStatus::SUCCESS:
+            return "SUCCESS";
+        case TransactionStatus::UNKNOWN_ACCOUNT:
+            return "UNKNOWN_ACCOUNT";
+        case TransactionStatus::ACCOUNT_EXISTS:
+            return "ACCOUNT_EXISTS";
+        case TransactionStatus::INVALID_AMOUNT:
+            return "INVALID_AMOUNT";
+        case TransactionStatus::INSUFFICIENT_FUNDS:
+            return "INSUFFICIENT_FUNDS";
+        case TransactionStatus::CASH_UNAVAILABLE:
+            return "CASH_UNAVAILABLE";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+} // namespace CommonEnum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CommonEnum {
+
+enum class TransactionType : uint8_t {
+    OPEN_ACCOUNT,
+    DEPOSIT,
+    WITHDRAW,
+    TRANSFER
+};
+
+enum class TransactionStatus {
+    SUCCESS,
+    UNKNOWN_ACCOUNT,
+    ACCOUNT_EXISTS,
+    INVALID_AMOUNT,
+    INSUFFICIENT_FUNDS,
+    CASH_UNAVAILABLE
+};
+
+// Utility functions for transaction enums
+const char* transactionTypeToString(TransactionType type);
+const char* transactionStatusToString(TransactionStatus status);
+
+} // namespace CommonEnum
@@ -0,0 +1,28 @@
+#include "ATMTerminal.hpp"
+
+namespace Controller {
+
+ATMTerminal::ATMTerminal(int id, Bank& bank, Utility::CashDispenser dispenser)
+    : id(id), bank(bank), dispenser(std::move(dispenser)) {}
+
+CommonEnum::TransactionStatus ATMTerminal::withdraw(uint32_t account, int64_t amount) {
+    auto notes = dispenser.plan(amount);
+    if (!notes) {
+        return CommonEnum::TransactionStatus::CASH_UNAVAILABLE;
+    }
+    auto status = bank.withdraw(account, amount);
+    if (status == CommonEnum::TransactionStatus::SUCCESS) {
+        dispenser.dispense(*notes);
+    }
+    return status;
+}
+
+CommonEnum::TransactionStatus ATMTerminal::deposit(uint32_t account, int64_t amount) {
+    return bank.deposit(account, amount);
+}
+
+CommonEnum::TransactionStatus ATMTerminal::transfer(uint32_t from, uint32_t to, int64_t amount) {
+    return bank.transfer(from, to, amount);
+}
+
+} // namespace Controller
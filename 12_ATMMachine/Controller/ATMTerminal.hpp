@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include "CommonEnum/TransactionType.hpp"
+#include "Utility/CashDispenser.hpp"
+#include "Bank.hpp"
+
+namespace Controller {
+
+// One physical ATM: owns its note cassettes and talks to the shared bank
+class ATMTerminal {
+private:
+    int id;
+    Bank& bank;
+    Utility::CashDispenser dispenser;
+
+public:
+    ATMTerminal(int id, Bank& bank, Utility::CashDispenser dispenser);
+
+    // Plans the notes first so an account is never debited for cash the ATM cannot pay
+    CommonEnum::TransactionStatus withdraw(uint32_t account, int64_t amount);
+    CommonEnum::TransactionStatus deposit(uint32_t account, int64_t amount);
+    CommonEnum::TransactionStatus transfer(uint32_t from, uint32_t to, int64_t amount);
+
+    // Getters
+    int getId() const { return id; }
+    Utility::CashDispenser& getDispenser() { return dispenser; }
+};
+
+} // namespace Controller
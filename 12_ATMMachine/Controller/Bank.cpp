@@ -0,0 +1,47 @@
+#include "Bank.hpp"
+
+namespace Controller {
+
+Bank::Bank(const BankConfig& config)
+    : log(config.logPath, config.syncOnCommit), ledger(config.maxAccounts, config.shardCount, &log),
+      recoveredRecords(0) {
+    recoveredRecords = Ledger::WriteAheadLog::replay(config.logPath, [this](const Utility::LogRecord& record) {
+        ledger.apply(record);
+    });
+}
+
+CommonEnum::TransactionStatus Bank::openAccount(uint32_t account, int64_t initialBalance) {
+    return commit(ledger.openAccount(account, initialBalance));
+}
+
+CommonEnum::TransactionStatus Bank::deposit(uint32_t account, int64_t amount) {
+    return commit(ledger.deposit(account, amount));
+}
+
+CommonEnum::TransactionStatus Bank::withdraw(uint32_t account, int64_t amount) {
+    return commit(ledger.withdraw(account, amount));
+}
+
+CommonEnum::TransactionStatus Bank::transfer(uint32_t from, uint32_t to, int64_t amount) {
+    return commit(ledger.transfer(from, to, amount));
+}
+
+void Bank::openAccounts(uint32_t count, int64_t initialBalance) {
+    uint64_t last = 0;
+    for (uint32_t account = 0; account < count; account++) {
+        auto result = ledger.openAccount(account, initialBalance);
+        if (result.isSuccess()) {
+            last = result.lsn;
+        }
+    }
+    log.waitDurable(last);
+}
+
+CommonEnum::TransactionStatus Bank::commit(const Ledger::LedgerResult& result) {
+    if (result.isSuccess() && result.lsn != 0) {
+        log.waitDurable(result.lsn);
+    }
+    return result.status;
+}
+
+} // namespace Controller
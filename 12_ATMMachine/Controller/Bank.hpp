@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "CommonEnum/TransactionType.hpp"
+#include "Ledger/ShardedLedger.hpp"
+#include "Ledger/WriteAheadLog.hpp"
+
+namespace Controller {
+
+struct BankConfig {
+    std::string logPath = "atm_ledger.wal";
+    std::size_t maxAccounts = 100000;
+    std::size_t shardCount = 64;
+    bool syncOnCommit = true;
+};
+
+// Bank backend shared by all terminals. Construction replays the
+// write-ahead log, so reopening after a crash restores every transaction
+// that was acknowledged.
+class Bank {
+private:
+    Ledger::WriteAheadLog log;
+    Ledger::ShardedLedger ledger;
+    uint64_t recoveredRecords;
+
+public:
+    explicit Bank(const BankConfig& config);
+
+    // Each call returns only once its log record is durable
+    CommonEnum::TransactionStatus openAccount(uint32_t account, int64_t initialBalance);
+    CommonEnum::TransactionStatus deposit(uint32_t account, int64_t amount);
+    CommonEnum::TransactionStatus withdraw(uint32_t account, int64_t amount);
+    CommonEnum::TransactionStatus transfer(uint32_t from, uint32_t to, int64_t amount);
+
+    // Bulk setup: logs every account and waits for a single commit
+    void openAccounts(uint32_t count, int64_t initialBalance);
+
+    // Getters
+    const Ledger::ShardedLedger& getLedger() const { return ledger; }
+    const Ledger::WriteAheadLog& getLog() const { return log; }
+    uint64_t getRecoveredRecords() const { return recoveredRecords; }
+
+private:
+    CommonEnum::TransactionStatus commit(const Ledger::LedgerResult& result);
+};
+
+} // namespace Controller
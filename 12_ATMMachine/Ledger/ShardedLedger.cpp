@@ -0,0 +1,184 @@
+#include "ShardedLedger.hpp"
+#include <stdexcept>
+
+namespace Ledger {
+
+using CommonEnum::TransactionStatus;
+using CommonEnum::TransactionType;
+
+namespace {
+LedgerResult failed(TransactionStatus status) {
+    LedgerResult result;
+    result.status = status;
+    return result;
+}
+}
+
+ShardedLedger::ShardedLedger(std::size_t maxAccounts, std::size_t shardCount, WriteAheadLog* log)
+    : maxAccounts(maxAccounts), log(log) {
+    if (shardCount == 0) {
+        throw std::invalid_argument("ShardedLedger: shardCount must be positive");
+    }
+    std::size_t perShard = (maxAccounts + shardCount - 1) / shardCount;
+    for (std::size_t i = 0; i < shardCount; i++) {
+        auto shard = std::make_unique<Shard>();
+        shard->balances.assign(perShard, 0);
+        shard->open.assign(perShard, 0);
+        shards.push_back(std::move(shard));
+    }
+}
+
+LedgerResult ShardedLedger::openAccount(uint32_t account, int64_t initialBalance) {
+    if (account >= maxAccounts) {
+        return failed(TransactionStatus::UNKNOWN_ACCOUNT);
+    }
+    if (initialBalance < 0) {
+        return failed(TransactionStatus::INVALID_AMOUNT);
+    }
+    Shard& shard = shardOf(account);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.open[slotOf(account)]) {
+        return failed(TransactionStatus::ACCOUNT_EXISTS);
+    }
+    LedgerResult result;
+    result.lsn = logRecord(TransactionType::OPEN_ACCOUNT, account, account, initialBalance);
+    shard.open[slotOf(account)] = 1;
+    shard.balances[slotOf(account)] = initialBalance;
+    return result;
+}
+
+LedgerResult ShardedLedger::deposit(uint32_t account, int64_t amount) {
+    if (amount <= 0) {
+        return failed(TransactionStatus::INVALID_AMOUNT);
+    }
+    if (account >= maxAccounts) {
+        return failed(TransactionStatus::UNKNOWN_ACCOUNT);
+    }
+    Shard& shard = shardOf(account);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.open[slotOf(account)]) {
+        return failed(TransactionStatus::UNKNOWN_ACCOUNT);
+    }
+    LedgerResult result;
+    result.lsn = logRecord(TransactionType::DEPOSIT, account, account, amount);
+    shard.balances[slotOf(account)] += amount;
+    return result;
+}
+
+LedgerResult ShardedLedger::withdraw(uint32_t account, int64_t amount) {
+    if (amount <= 0) {
+        return failed(TransactionStatus::INVALID_AMOUNT);
+    }
+    if (account >= maxAccounts) {
+        return failed(TransactionStatus::UNKNOWN_ACCOUNT);
+    }
+    Shard& shard = shardOf(account);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.open[slotOf(account)]) {
+        return failed(TransactionStatus::UNKNOWN_ACCOUNT);
+    }
+    int64_t& balance = shard.balances[slotOf(account)];
+    if (balance < amount) {
+        return failed(TransactionStatus::INSUFFICIENT_FUNDS);
+    }
+    LedgerResult result;
+    result.lsn = logRecord(TransactionType::WITHDRAW, account, account, amount);
+    balance -= amount;
+    return result;
+}
+
+LedgerResult ShardedLedger::transfer(uint32_t from, uint32_t to, int64_t amount) {
+    if (amount <= 0 || from == to) {
+        return failed(TransactionStatus::INVALID_AMOUNT);
+    }
+    if (from >= maxAccounts || to >= maxAccounts) {
+        return failed(TransactionStatus::UNKNOWN_ACCOUNT);
+    }
+    Shard& source = shardOf(from);
+    Shard& target = shardOf(to);
+    std::unique_lock<std::mutex> first, second;
+    if (&source == &target) {
+        first = std::unique_lock<std::mutex>(source.mutex);
+    } else if (from % shards.size() < to % shards.size()) {
+        first = std::unique_lock<std::mutex>(source.mutex);
+        second = std::unique_lock<std::mutex>(target.mutex);
+    } else {
+        first = std::unique_lock<std::mutex>(target.mutex);
+        second = std::unique_lock<std::mutex>(source.mutex);
+    }
+
+    if (!source.open[slotOf(from)] || !target.open[slotOf(to)]) {
+        return failed(TransactionStatus::UNKNOWN_ACCOUNT);
+    }
+    int64_t& fromBalance = source.balances[slotOf(from)];
+    if (fromBalance < amount) {
+        return failed(TransactionStatus::INSUFFICIENT_FUNDS);
+    }
+    LedgerResult result;
+    result.lsn = logRecord(TransactionType::TRANSFER, from, to, amount);
+    fromBalance -= amount;
+    target.balances[slotOf(to)] += amount;
+    return result;
+}
+
+void ShardedLedger::apply(const Utility::LogRecord& record) {
+    if (record.fromAccount >= maxAccounts || record.toAccount >= maxAccounts) {
+        throw std::out_of_range("ShardedLedger: log record references an account beyond capacity");
+    }
+    Shard& source = shardOf(record.fromAccount);
+    Shard& target = shardOf(record.toAccount);
+    switch (record.type) {
+        case TransactionType::OPEN_ACCOUNT:
+            source.open[slotOf(record.fromAccount)] = 1;
+            source.balances[slotOf(record.fromAccount)] = record.amount;
+            break;
+        case TransactionType::DEPOSIT:
+            source.balances[slotOf(record.fromAccount)] += record.amount;
+            break;
+        case TransactionType::WITHDRAW:
+            source.balances[slotOf(record.fromAccount)] -= record.amount;
+            break;
+        case TransactionType::TRANSFER:
+            source.balances[slotOf(record.fromAccount)] -= record.amount;
+            target.balances[slotOf(record.toAccount)] += record.amount;
+            break;
+    }
+}
+
+bool ShardedLedger::getBalance(uint32_t account, int64_t& balance) const {
+    if (account >= maxAccounts) {
+        return false;
+    }
+    Shard& shard = shardOf(account);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.open[slotOf(account)]) {
+        return false;
+    }
+    balance = shard.balances[slotOf(account)];
+    return true;
+}
+
+int64_t ShardedLedger::getTotalBalance() const {
+    int64_t total = 0;
+    for (const auto& shard : shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        for (int64_t balance : shard->balances) {
+            total += balance;
+        }
+    }
+    return total;
+}
+
+uint64_t ShardedLedger::logRecord(TransactionType type, uint32_t from, uint32_t to, int64_t amount) {
+    if (!log) {
+        return 0;
+    }
+    Utility::LogRecord record;
+    record.type = type;
+    record.fromAccount = from;
+    record.toAccount = to;
+    record.amount = amount;
+    return log->append(record);
+}
+
+} // namespace Ledger
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "CommonEnum/TransactionType.hpp"
+#include "Utility/LogRecord.hpp"
+#include "WriteAheadLog.hpp"
+
+namespace Ledger {
+
+struct LedgerResult {
+    CommonEnum::TransactionStatus status = CommonEnum::TransactionStatus::SUCCESS;
+    uint64_t lsn = 0;  // log position to wait on before acknowledging; 0 if nothing was logged
+
+    bool isSuccess() const { return status == CommonEnum::TransactionStatus::SUCCESS; }
+};
+
+// Account balances striped over shards by account id, each shard with its
+// own lock. A mutation validates and logs under the shard lock(s) so the
+// log order matches the order changes were applied; transfers lock both
+// shards in index order to stay deadlock-free.
+class ShardedLedger {
+private:
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::vector<int64_t> balances;  // cents
+        std::vector<uint8_t> open;
+    };
+
+    std::size_t maxAccounts;
+    std::vector<std::unique_ptr<Shard>> shards;
+    WriteAheadLog* log;  // optional; null for a purely in-memory ledger
+
+public:
+    ShardedLedger(std::size_t maxAccounts, std::size_t shardCount, WriteAheadLog* log = nullptr);
+
+    LedgerResult openAccount(uint32_t account, int64_t initialBalance);
+    LedgerResult deposit(uint32_t account, int64_t amount);
+    LedgerResult withdraw(uint32_t account, int64_t amount);
+    LedgerResult transfer(uint32_t from, uint32_t to, int64_t amount);
+
+    // Re-apply a committed record during recovery; it was validated when logged
+    void apply(const Utility::LogRecord& record);
+
+    bool getBalance(uint32_t account, int64_t& balance) const;
+    int64_t getTotalBalance() const;
+    std::size_t getMaxAccounts() const { return maxAccounts; }
+
+private:
+    Shard& shardOf(uint32_t account) const { return *shards[account % shards.size()]; }
+    std::size_t slotOf(uint32_t account) const { return account / shards.size(); }
+    uint64_t logRecord(CommonEnum::TransactionType type, uint32_t from, uint32_t to, int64_t amount);
+};
+
+} // namespace Ledger
@@ -0,0 +1,191 @@
+#include "WriteAheadLog.hpp"
+#include <cerrno>
+#include <fcntl.h>
+#include <stdexcept>
+#include <system_error>
+#include <unistd.h>
+
+namespace Ledger {
+
+namespace {
+
+// Length of the intact prefix of the log and the last LSN it contains
+std::pair<off_t, uint64_t> scanLog(int fd) {
+    std::vector<unsigned char> buffer(Utility::LogRecord::FRAME_SIZE * 4096);
+    off_t validBytes = 0;
+    uint64_t lastLsn = 0;
+    std::size_t carried = 0;
+    while (true) {
+        ssize_t got = ::pread(fd, buffer.data() + carried, buffer.size() - carried, validBytes + carried);
+        if (got < 0) {
+            throw std::system_error(errno, std::generic_category(), "WriteAheadLog: read failed");
+        }
+        std::size_t available = carried + static_cast<std::size_t>(got);
+        std::size_t offset = 0;
+        Utility::LogRecord record;
+        while (available - offset >= Utility::LogRecord::FRAME_SIZE) {
+            if (!Utility::LogRecord::decode(buffer.data() + offset, record) || record.lsn != lastLsn + 1) {
+                return {validBytes, lastLsn};
+            }
+            lastLsn = record.lsn;
+            offset += Utility::LogRecord::FRAME_SIZE;
+            validBytes += Utility::LogRecord::FRAME_SIZE;
+        }
+        if (got == 0) {
+            return {validBytes, lastLsn};
+        }
+        carried = available - offset;
+        std::copy(buffer.begin() + offset, buffer.begin() + available, buffer.begin());
+    }
+}
+
+}
+
+WriteAheadLog::WriteAheadLog(const std::string& path, bool syncOnCommit)
+    : fd(-1), syncOnCommit(syncOnCommit), nextLsn(1), lastBufferedLsn(0), durableLsn(0),
+      durableBytes(0), flushing(false), failed(false), groupCommits(0), recordsWritten(0) {
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "WriteAheadLog: cannot open " + path);
+    }
+    auto [validBytes, lastLsn] = scanLog(fd);
+    if (::ftruncate(fd, validBytes) != 0 || ::lseek(fd, validBytes, SEEK_SET) < 0) {
+        ::close(fd);
+        throw std::system_error(errno, std::generic_category(), "WriteAheadLog: cannot truncate torn tail");
+    }
+    nextLsn = lastLsn + 1;
+    lastBufferedLsn = lastLsn;
+    durableLsn = lastLsn;
+    durableBytes = validBytes;
+}
+
+WriteAheadLog::~WriteAheadLog() {
+    if (fd >= 0) {
+        try {
+            waitDurable(lastBufferedLsn);
+        } catch (const std::exception&) {
+            // Nothing more we can do on shutdown; recovery drops the unflushed tail
+        }
+        ::close(fd);
+    }
+}
+
+uint64_t WriteAheadLog::append(Utility::LogRecord record) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (failed) {
+        throw std::runtime_error("WriteAheadLog: log failed, no further appends accepted");
+    }
+    record.lsn = nextLsn++;
+    auto frame = record.encode();
+    pending.insert(pending.end(), frame.begin(), frame.end());
+    lastBufferedLsn = record.lsn;
+    return record.lsn;
+}
+
+void WriteAheadLog::waitDurable(uint64_t lsn) {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (durableLsn < lsn) {
+        if (failed) {
+            throw std::runtime_error("WriteAheadLog: log failed, records may not be durable");
+        }
+        if (flushing) {
+            flushed.wait(lock);
+            continue;
+        }
+        // Become the leader for everything buffered so far
+        flushing = true;
+        writing.swap(pending);
+        uint64_t batchEnd = lastBufferedLsn;
+        lock.unlock();
+
+        try {
+            writeFully(writing);
+            if (syncOnCommit && ::fdatasync(fd) != 0) {
+                throw std::system_error(errno, std::generic_category(), "WriteAheadLog: fdatasync failed");
+            }
+        } catch (...) {
+            // Hand leadership back so followers retry instead of hanging
+            lock.lock();
+            rollBackFlush();
+            flushing = false;
+            flushed.notify_all();
+            throw;
+        }
+        std::size_t records = writing.size() / Utility::LogRecord::FRAME_SIZE;
+        off_t batchBytes = static_cast<off_t>(writing.size());
+        writing.clear();
+
+        lock.lock();
+        durableLsn = batchEnd;
+        durableBytes += batchBytes;
+        flushing = false;
+        groupCommits++;
+        recordsWritten += records;
+        flushed.notify_all();
+    }
+}
+
+void WriteAheadLog::rollBackFlush() {
+    // Drop whatever part of the batch reached the file, torn frame included,
+    // then queue the batch ahead of records appended since
+    if (::ftruncate(fd, durableBytes) != 0 || ::lseek(fd, durableBytes, SEEK_SET) < 0) {
+        failed = true;
+    }
+    writing.insert(writing.end(), pending.begin(), pending.end());
+    pending.swap(writing);
+    writing.clear();
+}
+
+uint64_t WriteAheadLog::getGroupCommits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return groupCommits;
+}
+
+uint64_t WriteAheadLog::getRecordsWritten() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return recordsWritten;
+}
+
+uint64_t WriteAheadLog::replay(const std::string& path, const std::function<void(const Utility::LogRecord&)>& apply) {
+    int readFd = ::open(path.c_str(), O_RDONLY);
+    if (readFd < 0) {
+        return 0;  // no log yet: nothing to recover
+    }
+    off_t validBytes = scanLog(readFd).first;
+    std::vector<unsigned char> buffer(Utility::LogRecord::FRAME_SIZE * 4096);
+    uint64_t applied = 0;
+    off_t offset = 0;
+    while (offset < validBytes) {
+        std::size_t want = std::min<off_t>(buffer.size(), validBytes - offset);
+        ssize_t got = ::pread(readFd, buffer.data(), want, offset);
+        if (got <= 0) {
+            break;
+        }
+        Utility::LogRecord record;
+        for (ssize_t at = 0; at + static_cast<ssize_t>(Utility::LogRecord::FRAME_SIZE) <= got;
+             at += Utility::LogRecord::FRAME_SIZE) {
+            Utility::LogRecord::decode(buffer.data() + at, record);
+            apply(record);
+            applied++;
+        }
+        offset += got;
+    }
+    ::close(readFd);
+    return applied;
+}
+
+void WriteAheadLog::writeFully(const std::vector<unsigned char>& bytes) {
+    std::size_t written = 0;
+    while (written < bytes.size()) {
+        ssize_t result = ::write(fd, bytes.data() + written, bytes.size() - written);
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(), "WriteAheadLog: write failed");
+        }
+        written += static_cast<std::size_t>(result);
+    }
+}
+
+} // namespace Ledger
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+#include "Utility/LogRecord.hpp"
+
+namespace Ledger {
+
+// Append-only redo log with group commit. append() only copies the frame
+// into an in-memory batch; waitDurable() blocks until that record is on
+// disk. The first waiter to find no flush running becomes the leader and
+// writes + fsyncs everything batched so far for all waiters at once.
+//
+// If a flush fails, the file is truncated back to the last durable frame
+// and the batch is put back in front of newer records, so a later flush
+// rewrites it in LSN order. If even the truncation fails, the log is
+// marked failed and every later append() or waitDurable() throws.
+class WriteAheadLog {
+private:
+    int fd;
+    bool syncOnCommit;
+    mutable std::mutex mutex;
+    std::condition_variable flushed;
+    std::vector<unsigned char> pending;
+    std::vector<unsigned char> writing;
+    uint64_t nextLsn;
+    uint64_t lastBufferedLsn;
+    uint64_t durableLsn;
+    off_t durableBytes;         // end of the last frame known to be on disk
+    bool flushing;
+    bool failed;
+    uint64_t groupCommits;
+    uint64_t recordsWritten;
+
+public:
+    // Opens (or creates) the log, dropping any torn frame at its tail
+    explicit WriteAheadLog(const std::string& path, bool syncOnCommit = true);
+    ~WriteAheadLog();
+
+    WriteAheadLog(const WriteAheadLog&) = delete;
+    WriteAheadLog& operator=(const WriteAheadLog&) = delete;
+
+    // Assigns the next LSN and buffers the record; does not wait for disk.
+    // Throws std::runtime_error once the log has failed.
+    uint64_t append(Utility::LogRecord record);
+    // Throws std::system_error if the flush fails (the records stay queued
+    // for the next flush) and std::runtime_error once the log has failed
+    void waitDurable(uint64_t lsn);
+
+    // Calls `apply` for every intact record in LSN order; returns how many
+    static uint64_t replay(const std::string& path, const std::function<void(const Utility::LogRecord&)>& apply);
+
+    // Getters
+    uint64_t getGroupCommits() const;
+    uint64_t getRecordsWritten() const;
+
+private:
+    void writeFully(const std::vector<unsigned char>& bytes);
+    // Caller holds the mutex; undoes a failed flush of `writing`
+    void rollBackFlush();
+};
+
+} // namespace Ledger
@@ -0,0 +1,80 @@
+#include "CashDispenser.hpp"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace Utility {
+
+CashDispenser::CashDispenser(std::vector<uint32_t> denominations, std::vector<uint32_t> counts)
+    : denominations(std::move(denominations)), counts(std::move(counts)) {
+    if (this->denominations.size() != this->counts.size() || this->denominations.empty()) {
+        throw std::invalid_argument("CashDispenser: one count per denomination is required");
+    }
+    // Keep cassettes ordered largest first, counts following their notes
+    std::vector<std::size_t> order(this->denominations.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+        return this->denominations[a] > this->denominations[b];
+    });
+    std::vector<uint32_t> sortedNotes, sortedCounts;
+    for (std::size_t i : order) {
+        sortedNotes.push_back(this->denominations[i]);
+        sortedCounts.push_back(this->counts[i]);
+    }
+    this->denominations = std::move(sortedNotes);
+    this->counts = std::move(sortedCounts);
+}
+
+std::optional<std::vector<uint32_t>> CashDispenser::plan(int64_t amount) const {
+    if (amount <= 0) {
+        return std::nullopt;
+    }
+    // For cassettes i..: cash held, and the gcd every payable amount is a multiple of
+    std::vector<int64_t> capacityFrom(denominations.size() + 1, 0);
+    std::vector<int64_t> gcdFrom(denominations.size() + 1, 0);
+    for (std::size_t i = denominations.size(); i-- > 0;) {
+        capacityFrom[i] = capacityFrom[i + 1] + static_cast<int64_t>(denominations[i]) * counts[i];
+        gcdFrom[i] = std::gcd(gcdFrom[i + 1], static_cast<int64_t>(denominations[i]));
+    }
+    std::vector<uint32_t> notes(denominations.size(), 0);
+    if (!search(0, amount, notes, capacityFrom, gcdFrom)) {
+        return std::nullopt;
+    }
+    return notes;
+}
+
+bool CashDispenser::search(std::size_t index, int64_t remaining, std::vector<uint32_t>& notes,
+                           const std::vector<int64_t>& capacityFrom, const std::vector<int64_t>& gcdFrom) const {
+    if (remaining == 0) {
+        return true;
+    }
+    if (index == denominations.size() || capacityFrom[index] < remaining || remaining % gcdFrom[index] != 0) {
+        return false;
+    }
+    int64_t note = denominations[index];
+    int64_t most = std::min<int64_t>(counts[index], remaining / note);
+    for (int64_t take = most; take >= 0; take--) {
+        notes[index] = static_cast<uint32_t>(take);
+        if (search(index + 1, remaining - take * note, notes, capacityFrom, gcdFrom)) {
+            return true;
+        }
+    }
+    notes[index] = 0;
+    return false;
+}
+
+void CashDispenser::dispense(const std::vector<uint32_t>& notes) {
+    for (std::size_t i = 0; i < notes.size() && i < counts.size(); i++) {
+        counts[i] -= std::min(counts[i], notes[i]);
+    }
+}
+
+int64_t CashDispenser::getCashAvailable() const {
+    int64_t total = 0;
+    for (std::size_t i = 0; i < denominations.size(); i++) {
+        total += static_cast<int64_t>(denominations[i]) * counts[i];
+    }
+    return total;
+}
+
+} // namespace Utility
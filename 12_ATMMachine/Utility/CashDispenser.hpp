@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Utility {
+
+// Note cassettes of one terminal. Each terminal owns its dispenser, so no
+// locking is needed. Note selection is a depth-first search from the
+// largest denomination, pruned by remaining capacity and divisibility. It
+// returns the fewest-notes plan in the common case and still finds one
+// when greedy would fail (e.g. 60 from 50s and 20s).
+class CashDispenser {
+private:
+    std::vector<uint32_t> denominations;  // cents, largest first
+    std::vector<uint32_t> counts;
+
+public:
+    CashDispenser(std::vector<uint32_t> denominations, std::vector<uint32_t> counts);
+
+    // Notes per denomination for `amount`, or nullopt if the cassettes cannot make it
+    std::optional<std::vector<uint32_t>> plan(int64_t amount) const;
+    void dispense(const std::vector<uint32_t>& notes);
+    void refill(std::size_t cassette, uint32_t notes) { counts[cassette] += notes; }
+
+    // Getters
+    const std::vector<uint32_t>& getDenominations() const { return denominations; }
+    const std::vector<uint32_t>& getCounts() const { return counts; }
+    int64_t getCashAvailable() const;
+
+private:
+    bool search(std::size_t index, int64_t remaining, std::vector<uint32_t>& notes,
+                const std::vector<int64_t>& capacityFrom, const std::vector<int64_t>& gcdFrom) const;
+};
+
+} // namespace Utility
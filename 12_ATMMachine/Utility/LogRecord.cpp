@@ -0,0 +1,52 @@
+#include "LogRecord.hpp"
+#include <cstring>
+
+namespace Utility {
+
+namespace {
+
+uint32_t checksum(const unsigned char* data, std::size_t length) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (std::size_t i = 0; i < length; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Layout: lsn(8) type(1) pad(3) from(4) to(4) amount(8) checksum(4)
+constexpr std::size_t TYPE_OFFSET = 8;
+constexpr std::size_t FROM_OFFSET = 12;
+constexpr std::size_t TO_OFFSET = 16;
+constexpr std::size_t AMOUNT_OFFSET = 20;
+constexpr std::size_t CHECKSUM_OFFSET = 28;
+
+}
+
+LogRecord::Frame LogRecord::encode() const {
+    Frame frame{};
+    std::memcpy(frame.data(), &lsn, sizeof(lsn));
+    frame[TYPE_OFFSET] = static_cast<unsigned char>(type);
+    std::memcpy(frame.data() + FROM_OFFSET, &fromAccount, sizeof(fromAccount));
+    std::memcpy(frame.data() + TO_OFFSET, &toAccount, sizeof(toAccount));
+    std::memcpy(frame.data() + AMOUNT_OFFSET, &amount, sizeof(amount));
+    uint32_t sum = checksum(frame.data(), CHECKSUM_OFFSET);
+    std::memcpy(frame.data() + CHECKSUM_OFFSET, &sum, sizeof(sum));
+    return frame;
+}
+
+bool LogRecord::decode(const unsigned char* frame, LogRecord& out) {
+    uint32_t stored;
+    std::memcpy(&stored, frame + CHECKSUM_OFFSET, sizeof(stored));
+    if (stored != checksum(frame, CHECKSUM_OFFSET) || frame[TYPE_OFFSET] > static_cast<unsigned char>(CommonEnum::TransactionType::TRANSFER)) {
+        return false;
+    }
+    std::memcpy(&out.lsn, frame, sizeof(out.lsn));
+    out.type = static_cast<CommonEnum::TransactionType>(frame[TYPE_OFFSET]);
+    std::memcpy(&out.fromAccount, frame + FROM_OFFSET, sizeof(out.fromAccount));
+    std::memcpy(&out.toAccount, frame + TO_OFFSET, sizeof(out.toAccount));
+    std::memcpy(&out.amount, frame + AMOUNT_OFFSET, sizeof(out.amount));
+    return true;
+}
+
+} // namespace Utility
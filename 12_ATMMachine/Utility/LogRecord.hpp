@@ -0,0 +1,26 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "CommonEnum/TransactionType.hpp"
+
+namespace Utility {
+
+// One committed ledger mutation. Serialised as a fixed 32-byte frame with
+// a trailing checksum so recovery can detect a torn write at the log tail.
+struct LogRecord {
+    uint64_t lsn = 0;
+    CommonEnum::TransactionType type = CommonEnum::TransactionType::DEPOSIT;
+    uint32_t fromAccount = 0;
+    uint32_t toAccount = 0;
+    int64_t amount = 0;  // cents
+
+    static constexpr std::size_t FRAME_SIZE = 32;
+    using Frame = std::array<unsigned char, FRAME_SIZE>;
+
+    Frame encode() const;
+    // Returns false if the frame is corrupt or incomplete
+    static bool decode(const unsigned char* frame, LogRecord& out);
+};
+
+} // namespace Utility
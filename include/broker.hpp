@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "config.hpp"
+#include "producer.hpp"
+#include "ring_buffer.hpp"
+
+namespace loadtest {
+
+// What the in-memory broker keeps per record: delivery metadata and the
+// leading key bytes, not the payload itself
+struct BrokerMessage {
+    int64_t intendedNanos;
+    uint64_t key;
+    uint32_t size;
+};
+
+// Local stand-in for a real broker so produce -> consume can be measured
+// in one process. Routing follows the consumer mode:
+//  - SHARED: one lock-free MPMC queue that every consumer pops from
+//  - ROUND_ROBIN: an SPSC ring per (producer lane, consumer); each lane
+//    deals its records out to consumers in turn
+//  - FANOUT: a broadcast ring per producer lane; every consumer reads all
+// A send() claims a free producer lane for its duration, preferring the
+// one the calling thread used last, so each ring keeps a single writer at
+// a time. More concurrent senders than `producerLanes` wait for a lane.
+class InMemoryBroker : public RecordSink {
+public:
+    InMemoryBroker(ConsumerMode mode, int consumers, int producerLanes, std::size_t ringCapacity);
+
+    // Blocks (spin-yield) while no lane is free or the target ring is full;
+    // returns false without waiting further once the broker is closed
+    bool send(const RecordBatch& batch) override;
+    // Up to `max` messages for one consumer; 0 when nothing is ready
+    std::size_t poll(int consumer, BrokerMessage* out, std::size_t max);
+
+    // No more sends; consumers drain what is left and finish. Also called
+    // by a failing ConsumerEngine so producers stuck on a full ring return.
+    void close() { closed_.store(true, std::memory_order_release); }
+    bool isClosed() const { return closed_.load(std::memory_order_acquire); }
+
+    ConsumerMode getMode() const { return mode_; }
+    int getConsumers() const { return consumers_; }
+
+private:
+    // NO_LANE once the broker is closed while waiting for one
+    static constexpr std::size_t NO_LANE = static_cast<std::size_t>(-1);
+    std::size_t claimLane();
+    void releaseLane(std::size_t lane) { laneCursors_[lane].busy.store(false, std::memory_order_release); }
+
+    // Consumer-local scan position over producer lanes
+    struct alignas(64) ConsumerCursor {
+        std::size_t nextLane = 0;
+    };
+    // Claim flag and round-robin position of one producer lane
+    struct alignas(64) LaneCursor {
+        std::atomic<bool> busy{false};
+        std::size_t nextConsumer = 0;
+    };
+
+    ConsumerMode mode_;
+    int consumers_;
+    std::size_t producerLanes_;
+    uint64_t id_;
+    std::unique_ptr<MpmcQueue<BrokerMessage>> shared_;
+    std::vector<std::unique_ptr<SpscRing<BrokerMessage>>> roundRobin_;  // [lane * consumers + consumer]
+    std::vector<std::unique_ptr<BroadcastRing<BrokerMessage>>> fanout_;  // [lane]
+    std::unique_ptr<ConsumerCursor[]> consumerCursors_;
+    std::unique_ptr<LaneCursor[]> laneCursors_;
+    std::atomic<std::size_t> nextLane_;
+    std::atomic<bool> closed_;
+};
+
+} // namespace loadtest
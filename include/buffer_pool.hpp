@@ -0,0 +1,71 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace loadtest {
+
+// A record inside a batch. `data` points either into the batch's own
+// arena or, for static payloads, straight at the shared payload bytes.
+struct RecordView {
+    const char* data;
+    uint32_t size;
+    int64_t intendedNanos;  // steady_clock time the record was scheduled for
+};
+
+// Fixed-capacity batch whose records and payload bytes are allocated once
+class RecordBatch {
+public:
+    RecordBatch(std::size_t maxRecords, std::size_t arenaBytes);
+
+    void clear();
+    bool isFull() const { return records_.size() == maxRecords_; }
+    bool empty() const { return records_.empty(); }
+    std::size_t size() const { return records_.size(); }
+    std::size_t bytes() const { return bytes_; }
+
+    // Append a record referencing caller-owned bytes (zero-copy)
+    void addReference(const char* data, uint32_t size, int64_t intendedNanos);
+    // Reserve `size` bytes in the arena for a generated payload; nullptr if full
+    char* allocate(uint32_t size, int64_t intendedNanos);
+
+    const std::vector<RecordView>& records() const { return records_; }
+    // Wire encoding of the whole batch (e.g. compressed); empty when the
+    // records are sent as-is. The buffer keeps its capacity across clear().
+    std::vector<char>& encoded() { return encoded_; }
+    const std::vector<char>& encoded() const { return encoded_; }
+    std::size_t wireBytes() const { return encoded_.empty() ? bytes_ : encoded_.size(); }
+    int64_t firstIntendedNanos() const { return records_.empty() ? 0 : records_.front().intendedNanos; }
+
+private:
+    std::size_t maxRecords_;
+    std::vector<RecordView> records_;
+    std::vector<char> encoded_;
+    std::unique_ptr<char[]> arena_;
+    std::size_t arenaBytes_;
+    std::size_t arenaUsed_;
+    std::size_t bytes_;
+};
+
+// Per-worker pool of preallocated batches. acquire() blocks when every
+// batch is in flight, which bounds buffered records (backpressure).
+class BufferPool {
+public:
+    BufferPool(std::size_t batches, std::size_t recordsPerBatch, std::size_t arenaBytesPerBatch);
+
+    RecordBatch* acquire();
+    void release(RecordBatch* batch);
+
+    std::size_t capacity() const { return batches_.size(); }
+
+private:
+    std::vector<std::unique_ptr<RecordBatch>> batches_;
+    std::vector<RecordBatch*> free_;
+    std::mutex mutex_;
+    std::condition_variable available_;
+};
+
+} // namespace loadtest
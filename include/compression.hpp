@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "buffer_pool.hpp"
+
+namespace loadtest {
+
+// Block codec. Instances keep their match-finder tables between calls and
+// are not thread-safe, so each worker owns its own.
+class Codec {
+public:
+    virtual ~Codec() = default;
+    virtual std::string name() const = 0;
+    // Replaces `out` with the encoded block
+    virtual void compress(const char* data, std::size_t size, std::vector<char>& out) = 0;
+    // Replaces `out` with the decoded block; throws std::runtime_error on corrupt input
+    virtual void decompress(const char* data, std::size_t size, std::vector<char>& out) = 0;
+};
+
+// "none"/"" -> pass-through, "lz4" -> fast greedy LZ with a 64 KiB window,
+// "zstd" -> slower hash-chain LZ with lazy matching and a 1 MiB window.
+// Both LZ codecs are in-house implementations of the respective styles;
+// their output is not compatible with the real libraries.
+std::unique_ptr<Codec> createCodec(const std::string& name);
+
+struct CompressionStats {
+    uint64_t batches = 0;
+    uint64_t inputBytes = 0;
+    uint64_t outputBytes = 0;
+    uint64_t nanos = 0;
+
+    void merge(const CompressionStats& other);
+    double ratio() const { return outputBytes ? static_cast<double>(inputBytes) / outputBytes : 0.0; }
+    // CPU milliseconds spent per MiB of input
+    double cpuMillisPerMB() const { return inputBytes ? nanos / 1e6 / (inputBytes / 1048576.0) : 0.0; }
+};
+
+// Producer pipeline stage: frames every record of a batch (u32 length +
+// payload) into one buffer and compresses it as a single block into
+// batch.encoded(), so codec cost is paid per batch rather than per message.
+class CompressionStage {
+public:
+    explicit CompressionStage(const std::string& codecName);
+
+    bool isEnabled() const { return codec_ != nullptr; }
+    // Returns the nanoseconds spent, 0 when disabled
+    uint64_t process(RecordBatch& batch);
+
+    const CompressionStats& getStats() const { return stats_; }
+
+    // Inverse of the framing, for verification
+    static std::vector<std::string> unframe(const std::vector<char>& framed);
+
+private:
+    std::unique_ptr<Codec> codec_;
+    std::vector<char> framed_;
+    CompressionStats stats_;
+};
+
+} // namespace loadtest
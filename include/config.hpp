@@ -13,6 +13,7 @@ namespace loadtest {
 
 // Forward declarations
 class ClientOpts;
+class ConfigSnapshot;
 
 // Configuration structures
 struct PodSpec {
@@ -146,6 +147,9 @@ public:
     std::vector<std::string> getValidationErrors() const;
 
 private:
+    // Binary snapshots read and write the typed fields directly
+    friend class ConfigSnapshot;
+
     // Configuration data
     std::vector<std::string> endpoints_;
     std::string mode_;
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+#include "config.hpp"
+
+namespace loadtest {
+
+// Compiled form of a validated Config. The controller parses YAML once and
+// writes a snapshot; pods mmap it and copy the fields straight out, with no
+// YAML parsing. Layout: 32-byte header (magic, version, payload size,
+// FNV-1a checksum) followed by the fields in declaration order as
+// fixed-width integers and length-prefixed strings. Native byte order:
+// snapshots are meant for pods on the same architecture.
+class ConfigSnapshot {
+public:
+    // Writes to a temporary file and renames, so readers never see a partial snapshot.
+    // Throws std::invalid_argument if the config does not validate.
+    static void write(const Config& config, const std::string& path);
+    // Throws std::runtime_error on a missing, truncated or corrupt snapshot
+    static Config load(const std::string& path);
+
+    static std::string encode(const Config& config);
+    static Config decode(const char* data, std::size_t size);
+};
+
+} // namespace loadtest
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "config.hpp"
+
+namespace loadtest {
+
+// Watches config files (by modification time and size) and publishes each
+// new valid Config as an immutable shared_ptr swapped in atomically. An
+// edit that fails to load or validate is logged and the previous config
+// stays in effect.
+class ConfigWatcher {
+public:
+    // Loads the files once; throws std::invalid_argument if they do not validate
+    ConfigWatcher(std::vector<std::string> files, std::chrono::milliseconds pollInterval);
+    ~ConfigWatcher();
+
+    void start();
+    void stop();
+    // Checks the files now; true when a new config was published
+    bool poll();
+
+    std::shared_ptr<const Config> current() const { return std::atomic_load(&current_); }
+    // Bumped after every publish; cheap to check on the hot path
+    uint64_t getVersion() const { return version_.load(std::memory_order_acquire); }
+    uint64_t getRejected() const { return rejected_.load(std::memory_order_relaxed); }
+
+private:
+    using Signature = std::vector<std::pair<std::filesystem::file_time_type, std::uintmax_t>>;
+
+    Signature signature() const;
+    void loop();
+
+    std::vector<std::string> files_;
+    std::chrono::milliseconds pollInterval_;
+    std::shared_ptr<const Config> current_;
+    std::atomic<uint64_t> version_;
+    std::atomic<uint64_t> rejected_;
+    std::mutex pollMutex_;  // guards lastSignature_
+    Signature lastSignature_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool running_;
+    std::thread thread_;
+};
+
+// Per-thread view of a watcher's config. get() costs one atomic load and
+// only touches the shared pointer after a reload, so readers never contend
+// on the swap.
+class ConfigHandle {
+public:
+    explicit ConfigHandle(const ConfigWatcher& watcher) : watcher_(watcher), version_(0) {}
+
+    const Config& get() {
+        uint64_t version = watcher_.getVersion();
+        if (version != version_) {
+            config_ = watcher_.current();
+            version_ = version;
+        }
+        return *config_;
+    }
+
+private:
+    const ConfigWatcher& watcher_;
+    std::shared_ptr<const Config> config_;
+    uint64_t version_;
+};
+
+} // namespace loadtest
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "broker.hpp"
+#include "config.hpp"
+#include "metrics.hpp"
+
+namespace loadtest {
+
+struct ConsumerStats {
+    uint64_t records = 0;
+    uint64_t batches = 0;
+    uint64_t errors = 0;     // handler failures skipped under ignoreErrors
+    uint64_t minRecords = 0; // least any single consumer received
+    uint64_t maxRecords = 0; // most any single consumer received
+    double seconds = 0.0;
+
+    double recordsPerSecond() const { return seconds > 0 ? records / seconds : 0.0; }
+    double averageBatch() const { return batches ? static_cast<double>(records) / batches : 0.0; }
+};
+
+// Runs `pods * consumersPerPod` consumer threads against an in-memory
+// broker, each delivering up to `maxBatchSize` messages per poll to an
+// optional handler. A handler exception stops the engine and is rethrown
+// from join() unless `ignoreErrors` is set.
+class ConsumerEngine {
+public:
+    using BatchHandler = std::function<void(int consumer, const BrokerMessage* messages, std::size_t count)>;
+
+    ConsumerEngine(const Consumer& config, std::shared_ptr<InMemoryBroker> broker);
+    ~ConsumerEngine();
+
+    void setHandler(BatchHandler handler) { handler_ = std::move(handler); }
+    // Optional: record delivery latency and consumed-record counters
+    void setMetrics(std::shared_ptr<MetricsRegistry> metrics) { metrics_ = std::move(metrics); }
+
+    void start();
+    // Waits until the broker is closed and drained
+    ConsumerStats join();
+
+private:
+    void runConsumer(int index, ConsumerStats& stats);
+
+    Consumer config_;
+    std::shared_ptr<InMemoryBroker> broker_;
+    BatchHandler handler_;
+    std::shared_ptr<MetricsRegistry> metrics_;
+    std::vector<std::thread> threads_;
+    std::vector<ConsumerStats> results_;
+    std::chrono::steady_clock::time_point startTime_;
+    std::atomic<bool> failed_;
+    std::mutex errorMutex_;
+    std::exception_ptr error_;
+};
+
+} // namespace loadtest
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace loadtest {
+
+// HDR-style log-linear latency histogram. Values below 2^precisionBits
+// get exact buckets; above that every power of two is split into
+// 2^(precisionBits-1) linear sub-buckets, so the relative error stays
+// under 2^-(precisionBits-1) across the whole range. Recording is a
+// count-leading-zeros, a shift and one counter update.
+//
+// Single writer: record() is only called by the owning thread and uses
+// relaxed load/store instead of atomic read-modify-write, while other
+// threads may read (merge) at any time without locks.
+class LatencyHistogram {
+public:
+    explicit LatencyHistogram(int precisionBits = 7, uint64_t maxValue = 3600ULL * 1000000000ULL);
+
+    void record(uint64_t value) {
+        if (value > maxValue_) {
+            value = maxValue_;
+        }
+        bump(counts_[indexOf(value)], 1);
+        bump(total_, 1);
+        bump(sum_, value);
+        if (value < min_.load(std::memory_order_relaxed)) {
+            min_.store(value, std::memory_order_relaxed);
+        }
+        if (value > max_.load(std::memory_order_relaxed)) {
+            max_.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    // Reader side; safe to call concurrently with the writer
+    void mergeFrom(const LatencyHistogram& other);
+    // this := this - other, for turning cumulative snapshots into intervals
+    void subtract(const LatencyHistogram& other);
+    void reset();
+
+    uint64_t count() const { return total_.load(std::memory_order_relaxed); }
+    uint64_t min() const;
+    uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+    double mean() const;
+    uint64_t percentile(double percentile) const;
+
+private:
+    static void bump(std::atomic<uint64_t>& counter, uint64_t delta) {
+        counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    std::size_t indexOf(uint64_t value) const {
+        if (value < subBucketCount_) {
+            return static_cast<std::size_t>(value);
+        }
+        int shift = (63 - __builtin_clzll(value)) - (precisionBits_ - 1);
+        return static_cast<std::size_t>(shift) * halfCount_ + static_cast<std::size_t>(value >> shift);
+    }
+    uint64_t valueOf(std::size_t index) const;
+
+    int precisionBits_;
+    uint64_t maxValue_;
+    uint64_t subBucketCount_;
+    std::size_t halfCount_;
+    std::size_t bucketCount_;
+    std::unique_ptr<std::atomic<uint64_t>[]> counts_;
+    std::atomic<uint64_t> total_;
+    std::atomic<uint64_t> sum_;
+    std::atomic<uint64_t> min_;
+    std::atomic<uint64_t> max_;
+};
+
+} // namespace loadtest
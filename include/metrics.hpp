@@ -0,0 +1,142 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "config.hpp"
+#include "histogram.hpp"
+
+namespace loadtest {
+
+enum class Stage {
+    END_TO_END,  // intended send time -> sink accepted the record
+    COMPRESS,    // encoding one batch
+    SEND,        // one sink call for a whole batch
+    DELIVERY,    // intended send time -> handed to a consumer
+    STAGE_COUNT
+};
+
+enum class Counter {
+    RECORDS_SENT,
+    BATCHES_SENT,
+    BYTES_SENT,  // wire bytes, i.e. after compression
+    RECORDS_CONSUMED,
+    BATCHES_CONSUMED,
+    COUNTER_COUNT
+};
+
+constexpr std::size_t STAGE_COUNT = static_cast<std::size_t>(Stage::STAGE_COUNT);
+constexpr std::size_t COUNTER_COUNT = static_cast<std::size_t>(Counter::COUNTER_COUNT);
+
+std::string stageToString(Stage stage);
+std::string counterToString(Counter counter);
+
+// Owned by one thread: histograms and counters are written without
+// atomic read-modify-write and read concurrently by the registry.
+class ThreadRecorder {
+public:
+    ThreadRecorder();
+
+    void record(Stage stage, uint64_t nanos) { histograms_[static_cast<std::size_t>(stage)]->record(nanos); }
+    void add(Counter counter, uint64_t delta) {
+        auto& value = counters_[static_cast<std::size_t>(counter)].value;
+        value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    const LatencyHistogram& getHistogram(Stage stage) const { return *histograms_[static_cast<std::size_t>(stage)]; }
+    uint64_t getCounter(Counter counter) const {
+        return counters_[static_cast<std::size_t>(counter)].value.load(std::memory_order_relaxed);
+    }
+
+private:
+    // One cache line per counter so the reader never bounces the writer's line
+    struct alignas(64) PaddedCounter {
+        std::atomic<uint64_t> value{0};
+    };
+
+    std::array<std::unique_ptr<LatencyHistogram>, STAGE_COUNT> histograms_;
+    std::array<PaddedCounter, COUNTER_COUNT> counters_;
+};
+
+struct LatencySummary {
+    uint64_t count = 0;
+    uint64_t min = 0;
+    uint64_t max = 0;
+    double mean = 0.0;
+    uint64_t p50 = 0;
+    uint64_t p90 = 0;
+    uint64_t p99 = 0;
+    uint64_t p999 = 0;
+};
+
+// One report interval: latency covers only samples recorded since the
+// previous snapshot; counters carry both the running total and the rate.
+struct MetricsSnapshot {
+    int64_t timestampMillis = 0;  // wall clock
+    double intervalSeconds = 0.0;
+    std::array<LatencySummary, STAGE_COUNT> latency;
+    std::array<uint64_t, COUNTER_COUNT> totals{};
+    std::array<double, COUNTER_COUNT> ratesPerSecond{};
+};
+
+// Hands out per-thread recorders and merges them at report time
+class MetricsRegistry {
+public:
+    MetricsRegistry();
+
+    // Called once per worker thread; the recorder stays registered for the
+    // registry's lifetime so its samples survive the thread
+    std::shared_ptr<ThreadRecorder> createRecorder();
+
+    // Merges every recorder and returns the interval since the last call
+    MetricsSnapshot snapshot();
+
+private:
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<ThreadRecorder>> recorders_;
+    std::array<std::unique_ptr<LatencyHistogram>, STAGE_COUNT> previous_;
+    std::array<uint64_t, COUNTER_COUNT> previousTotals_;
+    std::chrono::steady_clock::time_point previousTime_;
+};
+
+// Periodically snapshots a registry and appends it to
+// `<recordDirectory>/metrics.jsonl` (format "json", one object per line) or
+// `<recordDirectory>/metrics.csv` (format "csv"). Latencies are in nanoseconds.
+class MetricsExporter {
+public:
+    MetricsExporter(std::shared_ptr<MetricsRegistry> registry, const Metrics& metrics,
+                    const Controller& controller, std::chrono::milliseconds interval);
+    ~MetricsExporter();
+
+    void start();
+    // Writes a final snapshot and joins the exporter thread
+    void stop();
+
+    void write(const MetricsSnapshot& snapshot);
+    const std::string& getPath() const { return path_; }
+
+private:
+    void loop();
+    void writeJson(const MetricsSnapshot& snapshot);
+    void writeCsv(const MetricsSnapshot& snapshot);
+
+    std::shared_ptr<MetricsRegistry> registry_;
+    std::chrono::milliseconds interval_;
+    bool csv_;
+    std::string path_;
+    std::ofstream out_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool running_;
+    std::thread thread_;
+};
+
+} // namespace loadtest
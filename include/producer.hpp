@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "config.hpp"
+#include "buffer_pool.hpp"
+#include "compression.hpp"
+#include "metrics.hpp"
+#include "token_bucket.hpp"
+
+namespace loadtest {
+
+// Destination for produced batches. send() may be called concurrently
+// from several workers and must not keep references past its return.
+// It returns false once the sink no longer accepts records; part of that
+// batch may already have been delivered.
+class RecordSink {
+public:
+    virtual ~RecordSink() = default;
+    virtual bool send(const RecordBatch& batch) = 0;
+};
+
+// Local sink that only counts what it receives, for measuring the
+// producer itself
+class CountingSink : public RecordSink {
+public:
+    bool send(const RecordBatch& batch) override;
+
+    uint64_t getRecords() const { return records_.load(std::memory_order_relaxed); }
+    uint64_t getBatches() const { return batches_.load(std::memory_order_relaxed); }
+    uint64_t getBytes() const { return bytes_.load(std::memory_order_relaxed); }
+
+private:
+    alignas(64) std::atomic<uint64_t> records_{0};
+    alignas(64) std::atomic<uint64_t> batches_{0};
+    alignas(64) std::atomic<uint64_t> bytes_{0};
+};
+
+struct ProducerStats {
+    uint64_t records = 0;
+    uint64_t batches = 0;
+    uint64_t bytes = 0;      // payload bytes
+    uint64_t wireBytes = 0;  // bytes handed to the sink, after compression
+    double seconds = 0.0;
+    int64_t maxLagNanos = 0;  // furthest any record fell behind its intended send time
+    CompressionStats compression;
+
+    double recordsPerSecond() const { return seconds > 0 ? records / seconds : 0.0; }
+};
+
+// Drives the load described by a loadtest::Producer config:
+//  - `parallelism` worker threads, each paced by its share of `throughput`
+//  - records batched up to `batchCount` (and `maxBytes`, which only a
+//    single oversized record can exceed) or `lingerMs`
+//  - each worker owns a pool of preallocated batches bounded by
+//    `maxBufferedRecords`; a full pool blocks the worker
+//  - `staticValue` records point at one shared payload instead of copying
+//  - `compression` ("none", "lz4", "zstd") encodes each full batch with a
+//    codec owned by the worker before it is sent
+//  - `useAsync` hands batches to a per-worker sender thread
+// A sink that refuses a batch stops the run, as if stop() had been called.
+class ProducerEngine {
+public:
+    ProducerEngine(const Producer& config, std::shared_ptr<RecordSink> sink);
+
+    // Runs until `duration` elapses, `count` records are sent (if > 0) or stop()
+    ProducerStats run(std::chrono::milliseconds duration);
+    void stop() { stopping_.store(true, std::memory_order_relaxed); }
+    // Optional: record send/end-to-end latency and throughput counters
+    void setMetrics(std::shared_ptr<MetricsRegistry> metrics) { metrics_ = std::move(metrics); }
+
+private:
+    void runWorker(uint64_t rate, uint64_t quota, TokenBucket::Clock::time_point start,
+                   TokenBucket::Clock::time_point deadline, ProducerStats& stats);
+
+    Producer config_;
+    std::shared_ptr<RecordSink> sink_;
+    std::string staticPayload_;
+    std::shared_ptr<MetricsRegistry> metrics_;
+    std::atomic<bool> stopping_;
+};
+
+} // namespace loadtest
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace loadtest {
+
+inline std::size_t roundUpToPowerOfTwo(std::size_t value) {
+    std::size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+// Bounded single-producer / single-consumer ring. Each side caches the
+// other side's index and only reloads it when the ring looks full/empty.
+template <typename T>
+class SpscRing {
+public:
+    explicit SpscRing(std::size_t capacity)
+        : slots_(roundUpToPowerOfTwo(std::max<std::size_t>(capacity, 2))), mask_(slots_.size() - 1) {}
+
+    bool tryPush(const T& item) {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        if (head - cachedTail_ > mask_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head - cachedTail_ > mask_) {
+                return false;
+            }
+        }
+        slots_[head & mask_] = item;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t popBatch(T* out, std::size_t max) {
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        if (cachedHead_ == tail) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+        }
+        std::size_t count = static_cast<std::size_t>(std::min<uint64_t>(cachedHead_ - tail, max));
+        for (std::size_t i = 0; i < count; i++) {
+            out[i] = slots_[(tail + i) & mask_];
+        }
+        if (count) {
+            tail_.store(tail + count, std::memory_order_release);
+        }
+        return count;
+    }
+
+    std::size_t capacity() const { return slots_.size(); }
+
+private:
+    std::vector<T> slots_;
+    std::size_t mask_;
+    alignas(64) std::atomic<uint64_t> head_{0};
+    uint64_t cachedTail_ = 0;  // producer-local
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    uint64_t cachedHead_ = 0;  // consumer-local
+};
+
+// Bounded multi-producer / multi-consumer queue (per-cell sequence numbers,
+// after Vyukov). popBatch claims a run of ready cells with a single CAS.
+template <typename T>
+class MpmcQueue {
+public:
+    explicit MpmcQueue(std::size_t capacity)
+        : cells_(new Cell[roundUpToPowerOfTwo(std::max<std::size_t>(capacity, 2))]),
+          mask_(roundUpToPowerOfTwo(std::max<std::size_t>(capacity, 2)) - 1) {
+        for (std::size_t i = 0; i <= mask_; i++) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool tryPush(const T& item) {
+        uint64_t pos = enqueue_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells_[pos & mask_];
+            int64_t diff = static_cast<int64_t>(cell->sequence.load(std::memory_order_acquire) - pos);
+            if (diff == 0) {
+                if (enqueue_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // full
+            } else {
+                pos = enqueue_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = item;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t popBatch(T* out, std::size_t max) {
+        uint64_t pos = dequeue_.load(std::memory_order_relaxed);
+        while (true) {
+            // Count consecutive published cells; none of them can be taken
+            // by anyone else until dequeue_ moves past them
+            std::size_t ready = 0;
+            while (ready < max) {
+                const Cell& cell = cells_[(pos + ready) & mask_];
+                if (cell.sequence.load(std::memory_order_acquire) != pos + ready + 1) {
+                    break;
+                }
+                ready++;
+            }
+            if (ready == 0) {
+                uint64_t current = dequeue_.load(std::memory_order_relaxed);
+                if (current == pos) {
+                    return 0;  // empty
+                }
+                pos = current;
+                continue;
+            }
+            if (dequeue_.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {
+                for (std::size_t i = 0; i < ready; i++) {
+                    Cell& cell = cells_[(pos + i) & mask_];
+                    out[i] = cell.value;
+                    cell.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+                }
+                return ready;
+            }
+        }
+    }
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+private:
+    struct Cell {
+        std::atomic<uint64_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_;
+    alignas(64) std::atomic<uint64_t> enqueue_{0};
+    alignas(64) std::atomic<uint64_t> dequeue_{0};
+};
+
+// Single-producer ring read by a fixed set of readers, each with its own
+// cursor; every reader sees every item. The producer is held back by the
+// slowest reader.
+template <typename T>
+class BroadcastRing {
+public:
+    BroadcastRing(std::size_t capacity, std::size_t readers)
+        : slots_(roundUpToPowerOfTwo(std::max<std::size_t>(capacity, 2))), mask_(slots_.size() - 1),
+          cursors_(new Cursor[readers]), readers_(readers) {
+        if (readers == 0) {
+            throw std::invalid_argument("BroadcastRing: at least one reader is required");
+        }
+    }
+
+    bool tryPush(const T& item) {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        if (head - cachedSlowest_ > mask_) {
+            uint64_t slowest = head;
+            for (std::size_t r = 0; r < readers_; r++) {
+                slowest = std::min(slowest, cursors_[r].position.load(std::memory_order_acquire));
+            }
+            cachedSlowest_ = slowest;
+            if (head - cachedSlowest_ > mask_) {
+                return false;
+            }
+        }
+        slots_[head & mask_] = item;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t popBatch(std::size_t reader, T* out, std::size_t max) {
+        uint64_t cursor = cursors_[reader].position.load(std::memory_order_relaxed);
+        std::size_t count = static_cast<std::size_t>(
+            std::min<uint64_t>(head_.load(std::memory_order_acquire) - cursor, max));
+        for (std::size_t i = 0; i < count; i++) {
+            out[i] = slots_[(cursor + i) & mask_];
+        }
+        if (count) {
+            cursors_[reader].position.store(cursor + count, std::memory_order_release);
+        }
+        return count;
+    }
+
+    std::size_t capacity() const { return slots_.size(); }
+
+private:
+    struct alignas(64) Cursor {
+        std::atomic<uint64_t> position{0};
+    };
+
+    std::vector<T> slots_;
+    std::size_t mask_;
+    std::unique_ptr<Cursor[]> cursors_;
+    std::size_t readers_;
+    alignas(64) std::atomic<uint64_t> head_{0};
+    uint64_t cachedSlowest_ = 0;  // producer-local
+};
+
+} // namespace loadtest
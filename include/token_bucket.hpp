@@ -0,0 +1,37 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace loadtest {
+
+// Schedule-based token bucket. Message i is *intended* to be sent at
+// start + i / rate, and that intended time travels with the record, so
+// latency is measured from when a message should have gone out rather than
+// from when a stalled producer finally got to it (no coordinated omission).
+// Tokens are never dropped while the producer lags; the lag is reported.
+class TokenBucket {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // ratePerSecond == 0 disables pacing
+    TokenBucket(uint64_t ratePerSecond, Clock::time_point start);
+
+    // Number of tokens due at `now` that have not been taken yet, at most `max`
+    uint64_t available(Clock::time_point now, uint64_t max) const;
+    // Take `count` tokens; returns the index of the first one
+    uint64_t take(uint64_t count);
+
+    Clock::time_point intendedTime(uint64_t token) const;
+    Clock::time_point nextTokenTime() const { return intendedTime(issued_); }
+
+    bool isPaced() const { return intervalNanos_ > 0.0; }
+    uint64_t getIssued() const { return issued_; }
+
+private:
+    Clock::time_point start_;
+    double intervalNanos_;
+    uint64_t issued_;
+};
+
+} // namespace loadtest
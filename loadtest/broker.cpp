@@ -0,0 +1,136 @@
+#include "broker.hpp"
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace loadtest {
+
+namespace {
+
+std::atomic<uint64_t> nextBrokerId{1};
+
+// Retries until the push succeeds; gives up once the broker is closed,
+// since nobody may be left to make room
+template <typename Push>
+bool pushBlocking(const InMemoryBroker& broker, Push push) {
+    while (!push()) {
+        if (broker.isClosed()) {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+}
+
+InMemoryBroker::InMemoryBroker(ConsumerMode mode, int consumers, int producerLanes, std::size_t ringCapacity)
+    : mode_(mode), consumers_(consumers), producerLanes_(static_cast<std::size_t>(producerLanes)),
+      id_(nextBrokerId.fetch_add(1, std::memory_order_relaxed)), nextLane_(0), closed_(false) {
+    if (consumers < 1 || producerLanes < 1 || ringCapacity == 0) {
+        throw std::invalid_argument("InMemoryBroker: consumers, producerLanes and ringCapacity must be positive");
+    }
+    switch (mode_) {
+        case ConsumerMode::SHARED:
+            shared_ = std::make_unique<MpmcQueue<BrokerMessage>>(ringCapacity);
+            break;
+        case ConsumerMode::ROUND_ROBIN:
+            for (std::size_t i = 0; i < producerLanes_ * consumers; i++) {
+                roundRobin_.push_back(std::make_unique<SpscRing<BrokerMessage>>(ringCapacity));
+            }
+            break;
+        case ConsumerMode::FANOUT:
+            for (std::size_t i = 0; i < producerLanes_; i++) {
+                fanout_.push_back(std::make_unique<BroadcastRing<BrokerMessage>>(ringCapacity, consumers));
+            }
+            break;
+        default:
+            throw std::invalid_argument("InMemoryBroker: unknown consumer mode");
+    }
+    consumerCursors_.reset(new ConsumerCursor[consumers]);
+    laneCursors_.reset(new LaneCursor[producerLanes_]);
+}
+
+std::size_t InMemoryBroker::claimLane() {
+    // The hint is keyed by broker id rather than address so a new broker at
+    // a recycled address never inherits a stale lane. New threads start at
+    // the next lane in turn to spread out.
+    thread_local std::pair<uint64_t, std::size_t> lastLane{0, 0};
+    std::size_t start = lastLane.first == id_ ? lastLane.second
+                      : nextLane_.fetch_add(1, std::memory_order_relaxed) % producerLanes_;
+    while (true) {
+        for (std::size_t i = 0; i < producerLanes_; i++) {
+            std::size_t lane = start + i < producerLanes_ ? start + i : start + i - producerLanes_;
+            std::atomic<bool>& busy = laneCursors_[lane].busy;
+            // Acquire pairs with the previous owner's release, so its ring
+            // writes and cursor are visible before this thread continues them
+            if (!busy.load(std::memory_order_relaxed) && !busy.exchange(true, std::memory_order_acquire)) {
+                lastLane = {id_, lane};
+                return lane;
+            }
+        }
+        if (isClosed()) {
+            return NO_LANE;
+        }
+        std::this_thread::yield();
+    }
+}
+
+bool InMemoryBroker::send(const RecordBatch& batch) {
+    if (isClosed()) {
+        return false;
+    }
+    std::size_t lane = claimLane();
+    if (lane == NO_LANE) {
+        return false;
+    }
+    LaneCursor& cursor = laneCursors_[lane];
+    bool pushed = true;
+    for (const auto& record : batch.records()) {
+        BrokerMessage message{record.intendedNanos, 0, record.size};
+        std::memcpy(&message.key, record.data, std::min<std::size_t>(sizeof(message.key), record.size));
+        switch (mode_) {
+            case ConsumerMode::SHARED:
+                pushed = pushBlocking(*this, [&] { return shared_->tryPush(message); });
+                break;
+            case ConsumerMode::ROUND_ROBIN: {
+                auto& ring = *roundRobin_[lane * consumers_ + cursor.nextConsumer];
+                pushed = pushBlocking(*this, [&] { return ring.tryPush(message); });
+                cursor.nextConsumer = cursor.nextConsumer + 1 == static_cast<std::size_t>(consumers_)
+                                    ? 0 : cursor.nextConsumer + 1;
+                break;
+            }
+            case ConsumerMode::FANOUT:
+                pushed = pushBlocking(*this, [&] { return fanout_[lane]->tryPush(message); });
+                break;
+        }
+        if (!pushed) {
+            break;
+        }
+    }
+    releaseLane(lane);
+    return pushed;
+}
+
+std::size_t InMemoryBroker::poll(int consumer, BrokerMessage* out, std::size_t max) {
+    if (mode_ == ConsumerMode::SHARED) {
+        return shared_->popBatch(out, max);
+    }
+    // Visit producer lanes starting after the last one served so a busy
+    // lane cannot starve the others
+    ConsumerCursor& cursor = consumerCursors_[consumer];
+    for (std::size_t i = 0; i < producerLanes_; i++) {
+        std::size_t lane = cursor.nextLane;
+        cursor.nextLane = lane + 1 == producerLanes_ ? 0 : lane + 1;
+        std::size_t count = mode_ == ConsumerMode::ROUND_ROBIN
+                          ? roundRobin_[lane * consumers_ + consumer]->popBatch(out, max)
+                          : fanout_[lane]->popBatch(consumer, out, max);
+        if (count) {
+            return count;
+        }
+    }
+    return 0;
+}
+
+} // namespace loadtest
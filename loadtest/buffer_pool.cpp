@@ -0,0 +1,67 @@
+#include "buffer_pool.hpp"
+#include <cstring>
+#include <stdexcept>
+
+namespace loadtest {
+
+RecordBatch::RecordBatch(std::size_t maxRecords, std::size_t arenaBytes)
+    : maxRecords_(maxRecords), arena_(arenaBytes ? new char[arenaBytes] : nullptr), arenaBytes_(arenaBytes),
+      arenaUsed_(0), bytes_(0) {
+    records_.reserve(maxRecords);
+    if (arenaBytes) {
+        // Pre-fill once so generated payloads only need their header written
+        std::memset(arena_.get(), 'x', arenaBytes);
+    }
+}
+
+void RecordBatch::clear() {
+    records_.clear();
+    encoded_.clear();
+    arenaUsed_ = 0;
+    bytes_ = 0;
+}
+
+void RecordBatch::addReference(const char* data, uint32_t size, int64_t intendedNanos) {
+    records_.push_back({data, size, intendedNanos});
+    bytes_ += size;
+}
+
+char* RecordBatch::allocate(uint32_t size, int64_t intendedNanos) {
+    if (arenaUsed_ + size > arenaBytes_ || isFull()) {
+        return nullptr;
+    }
+    char* data = arena_.get() + arenaUsed_;
+    arenaUsed_ += size;
+    records_.push_back({data, size, intendedNanos});
+    bytes_ += size;
+    return data;
+}
+
+BufferPool::BufferPool(std::size_t batches, std::size_t recordsPerBatch, std::size_t arenaBytesPerBatch) {
+    if (batches == 0 || recordsPerBatch == 0) {
+        throw std::invalid_argument("BufferPool: need at least one batch of one record");
+    }
+    for (std::size_t i = 0; i < batches; i++) {
+        batches_.push_back(std::make_unique<RecordBatch>(recordsPerBatch, arenaBytesPerBatch));
+        free_.push_back(batches_.back().get());
+    }
+}
+
+RecordBatch* BufferPool::acquire() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    available_.wait(lock, [this] { return !free_.empty(); });
+    RecordBatch* batch = free_.back();
+    free_.pop_back();
+    batch->clear();
+    return batch;
+}
+
+void BufferPool::release(RecordBatch* batch) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_.push_back(batch);
+    }
+    available_.notify_one();
+}
+
+} // namespace loadtest
@@ -0,0 +1,696 @@
+#include "compression.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace loadtest {
+
+namespace {
+
+constexpr std::size_t MIN_MATCH = 4;
+// Largest block either LZ codec encodes, and so the largest size a frame
+// may declare
+constexpr uint64_t MAX_BLOCK = 1ULL << 31;
+
+uint32_t read32(const unsigned char* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+std::size_t matchLength(const unsigned char* a, const unsigned char* b, const unsigned char* end) {
+    const unsigned char* start = b;
+    while (b + 8 <= end) {
+        uint64_t x, y;
+        std::memcpy(&x, a, 8);
+        std::memcpy(&y, b, 8);
+        if (x != y) {
+            return (b - start) + (__builtin_ctzll(x ^ y) >> 3);
+        }
+        a += 8;
+        b += 8;
+    }
+    while (b < end && *a == *b) {
+        a++;
+        b++;
+    }
+    return b - start;
+}
+
+void putVarint(std::vector<char>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+uint64_t getVarint(const unsigned char*& p, const unsigned char* end) {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (p == end) {
+            throw std::runtime_error("codec: truncated varint");
+        }
+        unsigned char byte = *p++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+    throw std::runtime_error("codec: malformed varint");
+}
+
+// The declared original size of a frame, rejected before anything is
+// allocated for it if it exceeds what `limit` input bytes could encode
+uint64_t getOriginalSize(const unsigned char*& p, const unsigned char* end, uint64_t limit) {
+    uint64_t original = getVarint(p, end);
+    if (original > std::min(limit, MAX_BLOCK)) {
+        throw std::runtime_error("codec: declared size exceeds block limit");
+    }
+    return original;
+}
+
+// Decoded output may never run past the declared size
+void checkRoom(const std::vector<char>& out, uint64_t original, uint64_t length) {
+    if (length > original - out.size()) {
+        throw std::runtime_error("codec: output exceeds declared size");
+    }
+}
+
+// Copies a back-reference; byte-wise when source and destination overlap
+void copyMatch(std::vector<char>& out, std::size_t offset, std::size_t length) {
+    if (offset == 0 || offset > out.size()) {
+        throw std::runtime_error("codec: match offset out of range");
+    }
+    std::size_t from = out.size() - offset;
+    out.resize(out.size() + length);
+    char* dst = out.data() + out.size() - length;
+    const char* src = out.data() + from;
+    if (offset >= length) {
+        std::memcpy(dst, src, length);
+    } else {
+        for (std::size_t i = 0; i < length; i++) {
+            dst[i] = src[i];
+        }
+    }
+}
+
+void appendLiterals(std::vector<char>& out, const unsigned char*& p, const unsigned char* end, std::size_t length) {
+    if (static_cast<std::size_t>(end - p) < length) {
+        throw std::runtime_error("codec: truncated literals");
+    }
+    out.insert(out.end(), p, p + length);
+    p += length;
+}
+
+// Match-finder positions are stored as base_ + index so the tables never
+// need clearing between blocks: anything below the current base is stale.
+class PositionBase {
+protected:
+    // Returns the base for a new block of `size` bytes, resetting `tables`
+    // (via the callback) when positions would overflow
+    template <typename Reset>
+    uint32_t nextBase(std::size_t size, Reset reset) {
+        if (size > MAX_BLOCK) {
+            throw std::invalid_argument("codec: block larger than 2 GiB");
+        }
+        if (static_cast<uint64_t>(base_) + size * 2 + 1 >= UINT32_MAX) {
+            reset();
+            base_ = 1;
+        }
+        uint32_t current = base_;
+        base_ += static_cast<uint32_t>(size) + 1;
+        return current;
+    }
+
+    uint32_t base_ = 1;
+};
+
+class NoneCodec : public Codec {
+public:
+    std::string name() const override { return "none"; }
+
+    void compress(const char* data, std::size_t size, std::vector<char>& out) override {
+        out.assign(data, data + size);
+    }
+
+    void decompress(const char* data, std::size_t size, std::vector<char>& out) override {
+        out.assign(data, data + size);
+    }
+};
+
+// LZ4-style block: [varint original size] then sequences of
+// token(literal len:4 | match len - 4:4), extra length bytes of 255...,
+// literals, 16-bit offset, extra match length bytes. The final sequence has
+// literals only.
+class FastLzCodec : public Codec, private PositionBase {
+public:
+    FastLzCodec() : table_(1u << HASH_BITS, 0) {}
+
+    std::string name() const override { return "lz4"; }
+
+    void compress(const char* data, std::size_t size, std::vector<char>& out) override {
+        out.clear();
+        out.reserve(size + size / 255 + 16);
+        putVarint(out, size);
+        const auto* in = reinterpret_cast<const unsigned char*>(data);
+        const unsigned char* end = in + size;
+        uint32_t base = nextBase(size, [this] { std::fill(table_.begin(), table_.end(), 0); });
+
+        const unsigned char* anchor = in;
+        const unsigned char* p = in;
+        const unsigned char* limit = size >= MIN_MATCH ? end - MIN_MATCH : in;
+        unsigned misses = 0;
+        while (p < limit) {
+            uint32_t& slot = table_[hash(read32(p))];
+            uint32_t candidate = slot;
+            slot = base + static_cast<uint32_t>(p - in);
+            if (candidate >= base) {
+                const unsigned char* match = in + (candidate - base);
+                if (p - match <= MAX_OFFSET && read32(match) == read32(p)) {
+                    std::size_t length = MIN_MATCH + matchLength(match + MIN_MATCH, p + MIN_MATCH, end);
+                    emit(out, anchor, p - anchor, static_cast<uint16_t>(p - match), length);
+                    p += length;
+                    anchor = p;
+                    misses = 0;
+                    if (p - 2 >= in && p < limit) {
+                        table_[hash(read32(p - 2))] = base + static_cast<uint32_t>(p - 2 - in);
+                    }
+                    continue;
+                }
+            }
+            // Skip faster through incompressible data
+            p += 1 + (misses++ >> 6);
+        }
+        emitLiterals(out, anchor, end - anchor);
+    }
+
+    void decompress(const char* data, std::size_t size, std::vector<char>& out) override {
+        const auto* p = reinterpret_cast<const unsigned char*>(data);
+        const unsigned char* end = p + size;
+        // No input byte decodes to more than 255 output bytes
+        uint64_t original = getOriginalSize(p, end, static_cast<uint64_t>(size) * MAX_EXPANSION);
+        out.clear();
+        out.reserve(original);
+        while (true) {
+            if (p == end) {
+                throw std::runtime_error("lz4: missing token");
+            }
+            unsigned token = *p++;
+            std::size_t literals = readLength(p, end, token >> 4);
+            checkRoom(out, original, literals);
+            appendLiterals(out, p, end, literals);
+            if (p == end) {
+                break;
+            }
+            if (end - p < 2) {
+                throw std::runtime_error("lz4: truncated offset");
+            }
+            std::size_t offset = p[0] | (p[1] << 8);
+            p += 2;
+            std::size_t length = readLength(p, end, token & 0x0F) + MIN_MATCH;
+            checkRoom(out, original, length);
+            copyMatch(out, offset, length);
+        }
+        if (out.size() != original) {
+            throw std::runtime_error("lz4: size mismatch");
+        }
+    }
+
+private:
+    static constexpr unsigned HASH_BITS = 14;
+    static constexpr std::ptrdiff_t MAX_OFFSET = 65535;
+    static constexpr uint64_t MAX_EXPANSION = 255;
+
+    static uint32_t hash(uint32_t value) { return (value * 2654435761u) >> (32 - HASH_BITS); }
+
+    static void putLength(std::vector<char>& out, std::size_t length) {
+        while (length >= 255) {
+            out.push_back(static_cast<char>(255));
+            length -= 255;
+        }
+        out.push_back(static_cast<char>(length));
+    }
+
+    static std::size_t readLength(const unsigned char*& p, const unsigned char* end, unsigned nibble) {
+        std::size_t length = nibble;
+        if (nibble == 15) {
+            unsigned char byte;
+            do {
+                if (p == end) {
+                    throw std::runtime_error("lz4: truncated length");
+                }
+                byte = *p++;
+                length += byte;
+            } while (byte == 255);
+        }
+        return length;
+    }
+
+    static void emitLiterals(std::vector<char>& out, const unsigned char* literals, std::size_t count) {
+        out.push_back(static_cast<char>(std::min<std::size_t>(count, 15) << 4));
+        if (count >= 15) {
+            putLength(out, count - 15);
+        }
+        out.insert(out.end(), literals, literals + count);
+    }
+
+    static void emit(std::vector<char>& out, const unsigned char* literals, std::size_t count,
+                     uint16_t offset, std::size_t length) {
+        std::size_t matchCode = length - MIN_MATCH;
+        out.push_back(static_cast<char>((std::min<std::size_t>(count, 15) << 4) | std::min<std::size_t>(matchCode, 15)));
+        if (count >= 15) {
+            putLength(out, count - 15);
+        }
+        out.insert(out.end(), literals, literals + count);
+        out.push_back(static_cast<char>(offset & 0xFF));
+        out.push_back(static_cast<char>(offset >> 8));
+        if (matchCode >= 15) {
+            putLength(out, matchCode - 15);
+        }
+    }
+
+    std::vector<uint32_t> table_;
+};
+
+// Order-0 canonical Huffman coding of a literal stream, with code lengths
+// capped at HUFFMAN_BITS so decoding is one table lookup per symbol.
+// Section layout: mode byte (0 = raw, 1 = Huffman); raw bytes, or 128 bytes
+// of packed 4-bit code lengths, varint bitstream size and the MSB-first bitstream.
+constexpr unsigned HUFFMAN_BITS = 12;
+
+void huffmanLengths(const std::array<uint64_t, 256>& frequencies, std::array<uint8_t, 256>& lengths) {
+    std::array<uint64_t, 256> scaled = frequencies;
+    while (true) {
+        lengths.fill(0);
+        struct Node {
+            uint64_t weight;
+            int left;
+            int right;
+        };
+        std::vector<Node> nodes;
+        std::vector<std::pair<uint64_t, int>> heap;
+        for (int symbol = 0; symbol < 256; symbol++) {
+            if (scaled[symbol]) {
+                nodes.push_back({scaled[symbol], -1, symbol});
+                heap.emplace_back(scaled[symbol], static_cast<int>(nodes.size()) - 1);
+            }
+        }
+        if (nodes.size() == 1) {
+            lengths[nodes[0].right] = 1;
+            return;
+        }
+        auto greater = [](const auto& a, const auto& b) { return a.first > b.first; };
+        std::make_heap(heap.begin(), heap.end(), greater);
+        while (heap.size() > 1) {
+            std::pop_heap(heap.begin(), heap.end(), greater);
+            auto a = heap.back();
+            heap.pop_back();
+            std::pop_heap(heap.begin(), heap.end(), greater);
+            auto b = heap.back();
+            heap.pop_back();
+            nodes.push_back({a.first + b.first, a.second, b.second});
+            heap.emplace_back(a.first + b.first, static_cast<int>(nodes.size()) - 1);
+            std::push_heap(heap.begin(), heap.end(), greater);
+        }
+        // Leaves are the nodes with left == -1; walk from the root for depths
+        unsigned longest = 0;
+        std::vector<std::pair<int, unsigned>> stack{{heap.front().second, 0}};
+        while (!stack.empty()) {
+            auto [index, depth] = stack.back();
+            stack.pop_back();
+            if (nodes[index].left < 0) {
+                lengths[nodes[index].right] = static_cast<uint8_t>(depth);
+                longest = std::max(longest, depth);
+            } else {
+                stack.emplace_back(nodes[index].left, depth + 1);
+                stack.emplace_back(nodes[index].right, depth + 1);
+            }
+        }
+        if (longest <= HUFFMAN_BITS) {
+            return;
+        }
+        // Flatten the distribution and retry until the tree is shallow enough
+        for (auto& weight : scaled) {
+            if (weight) {
+                weight = (weight >> 1) | 1;
+            }
+        }
+    }
+}
+
+// Canonical codes: shorter first, then by symbol
+void canonicalCodes(const std::array<uint8_t, 256>& lengths, std::array<uint16_t, 256>& codes) {
+    uint16_t code = 0;
+    for (unsigned length = 1; length <= HUFFMAN_BITS; length++) {
+        for (int symbol = 0; symbol < 256; symbol++) {
+            if (lengths[symbol] == length) {
+                codes[symbol] = code++;
+            }
+        }
+        code <<= 1;
+    }
+}
+
+void encodeLiterals(const std::vector<unsigned char>& literals, std::vector<char>& out) {
+    std::array<uint64_t, 256> frequencies{};
+    for (unsigned char c : literals) {
+        frequencies[c]++;
+    }
+    std::array<uint8_t, 256> lengths;
+    uint64_t bits = 0;
+    if (literals.size() >= 256) {
+        huffmanLengths(frequencies, lengths);
+        for (int symbol = 0; symbol < 256; symbol++) {
+            bits += frequencies[symbol] * lengths[symbol];
+        }
+    }
+    if (literals.size() < 256 || bits / 8 + 140 >= literals.size()) {
+        out.push_back(0);
+        out.insert(out.end(), literals.begin(), literals.end());
+        return;
+    }
+
+    std::array<uint16_t, 256> codes{};
+    canonicalCodes(lengths, codes);
+    out.push_back(1);
+    for (int symbol = 0; symbol < 256; symbol += 2) {
+        out.push_back(static_cast<char>(lengths[symbol] | (lengths[symbol + 1] << 4)));
+    }
+    putVarint(out, (bits + 7) / 8);
+    uint64_t accumulator = 0;
+    unsigned pending = 0;
+    for (unsigned char c : literals) {
+        accumulator = (accumulator << lengths[c]) | codes[c];
+        pending += lengths[c];
+        while (pending >= 8) {
+            pending -= 8;
+            out.push_back(static_cast<char>(accumulator >> pending));
+        }
+    }
+    if (pending) {
+        out.push_back(static_cast<char>(accumulator << (8 - pending)));
+    }
+}
+
+void decodeLiterals(const unsigned char*& p, const unsigned char* end, std::size_t count,
+                    std::vector<unsigned char>& literals) {
+    if (p == end) {
+        throw std::runtime_error("zstd: missing literal section");
+    }
+    // Every literal costs at least one bit, so the input bounds the count
+    // before anything is allocated for it
+    if (count > static_cast<uint64_t>(end - p) * 8) {
+        throw std::runtime_error("zstd: literal count exceeds input");
+    }
+    unsigned mode = *p++;
+    literals.resize(count);
+    if (mode == 0) {
+        if (static_cast<std::size_t>(end - p) < count) {
+            throw std::runtime_error("zstd: truncated literals");
+        }
+        std::memcpy(literals.data(), p, count);
+        p += count;
+        return;
+    }
+    if (mode != 1 || end - p < 128) {
+        throw std::runtime_error("zstd: bad literal section");
+    }
+    std::array<uint8_t, 256> lengths;
+    for (int symbol = 0; symbol < 256; symbol += 2) {
+        lengths[symbol] = p[symbol / 2] & 0x0F;
+        lengths[symbol + 1] = p[symbol / 2] >> 4;
+    }
+    p += 128;
+    std::array<uint16_t, 256> codes{};
+    canonicalCodes(lengths, codes);
+    // entry = symbol | length << 8; length 0 marks an unused pattern
+    std::array<uint16_t, 1u << HUFFMAN_BITS> table{};
+    for (int symbol = 0; symbol < 256; symbol++) {
+        unsigned length = lengths[symbol];
+        if (length == 0 || length > HUFFMAN_BITS) {
+            continue;
+        }
+        unsigned first = codes[symbol] << (HUFFMAN_BITS - length);
+        unsigned last = (codes[symbol] + 1u) << (HUFFMAN_BITS - length);
+        if (last > table.size()) {
+            throw std::runtime_error("zstd: invalid code lengths");
+        }
+        for (unsigned i = first; i < last; i++) {
+            table[i] = static_cast<uint16_t>(symbol | (length << 8));
+        }
+    }
+
+    uint64_t streamBytes = getVarint(p, end);
+    if (static_cast<uint64_t>(end - p) < streamBytes) {
+        throw std::runtime_error("zstd: truncated literal bitstream");
+    }
+    const unsigned char* stream = p;
+    const unsigned char* streamEnd = p + streamBytes;
+    p = streamEnd;
+    uint64_t accumulator = 0;
+    unsigned available = 0;
+    for (std::size_t i = 0; i < count; i++) {
+        while (available < HUFFMAN_BITS) {
+            accumulator = (accumulator << 8) | (stream < streamEnd ? *stream++ : 0);
+            available += 8;
+        }
+        uint16_t entry = table[(accumulator >> (available - HUFFMAN_BITS)) & ((1u << HUFFMAN_BITS) - 1)];
+        unsigned length = entry >> 8;
+        if (length == 0 || length > available) {
+            throw std::runtime_error("zstd: corrupt literal bitstream");
+        }
+        literals[i] = static_cast<unsigned char>(entry & 0xFF);
+        available -= length;
+    }
+}
+
+// zstd-style trade-off: larger window, hash chains searched `depth` deep,
+// one step of lazy matching, and literals split into their own
+// Huffman-coded section ahead of the varint sequences
+// [literal len][match len - 4][offset]. Costs more CPU than the lz4 codec
+// for a better ratio on text-like payloads.
+class DeepLzCodec : public Codec, private PositionBase {
+public:
+    explicit DeepLzCodec(unsigned depth = 16)
+        : depth_(depth), head_(1u << HASH_BITS, 0), chain_(WINDOW, 0) {}
+
+    std::string name() const override { return "zstd"; }
+
+    void compress(const char* data, std::size_t size, std::vector<char>& out) override {
+        in_ = reinterpret_cast<const unsigned char*>(data);
+        end_ = in_ + size;
+        currentBase_ = nextBase(size, [this] {
+            std::fill(head_.begin(), head_.end(), 0);
+            std::fill(chain_.begin(), chain_.end(), 0);
+        });
+        literals_.clear();
+        sequences_.clear();
+
+        const unsigned char* anchor = in_;
+        const unsigned char* p = in_;
+        const unsigned char* limit = size >= MIN_MATCH ? end_ - MIN_MATCH : in_;
+        while (p < limit) {
+            std::size_t offset = 0;
+            std::size_t length = findAndInsert(p, offset);
+            if (length < MIN_MATCH) {
+                p++;
+                continue;
+            }
+            const unsigned char* inserted = p + 1;
+            // Lazy step: prefer a longer match starting one byte later
+            if (p + 1 < limit) {
+                std::size_t nextOffset = 0;
+                std::size_t nextLength = findAndInsert(p + 1, nextOffset);
+                inserted = p + 2;
+                if (nextLength > length) {
+                    p++;
+                    length = nextLength;
+                    offset = nextOffset;
+                }
+            }
+            putVarint(sequences_, p - anchor);
+            literals_.insert(literals_.end(), anchor, p);
+            putVarint(sequences_, length - MIN_MATCH);
+            putVarint(sequences_, offset);
+            const unsigned char* matchEnd = p + length;
+            for (const unsigned char* q = inserted; q < matchEnd && q < limit; q++) {
+                insert(q);
+            }
+            p = matchEnd;
+            anchor = p;
+        }
+        putVarint(sequences_, end_ - anchor);
+        literals_.insert(literals_.end(), anchor, end_);
+
+        out.clear();
+        out.reserve(literals_.size() + sequences_.size() + 160);
+        putVarint(out, size);
+        putVarint(out, literals_.size());
+        encodeLiterals(literals_, out);
+        out.insert(out.end(), sequences_.begin(), sequences_.end());
+    }
+
+    void decompress(const char* data, std::size_t size, std::vector<char>& out) override {
+        const auto* p = reinterpret_cast<const unsigned char*>(data);
+        const unsigned char* end = p + size;
+        // Match lengths are plain varints, so the format has no expansion
+        // bound: only the block limit applies, and the up-front reservation
+        // is capped so a forged size alone cannot allocate much
+        uint64_t original = getOriginalSize(p, end, MAX_BLOCK);
+        uint64_t literalCount = getVarint(p, end);
+        if (literalCount > original) {
+            throw std::runtime_error("zstd: literal count exceeds block size");
+        }
+        decodeLiterals(p, end, literalCount, literals_);
+        out.clear();
+        out.reserve(std::min<uint64_t>(original, static_cast<uint64_t>(size) * RESERVE_RATIO + literalCount));
+        const unsigned char* literal = literals_.data();
+        const unsigned char* literalEnd = literal + literals_.size();
+        while (true) {
+            uint64_t count = getVarint(p, end);
+            if (static_cast<uint64_t>(literalEnd - literal) < count) {
+                throw std::runtime_error("zstd: sequence overruns literals");
+            }
+            checkRoom(out, original, count);
+            out.insert(out.end(), literal, literal + count);
+            literal += count;
+            if (p == end) {
+                break;
+            }
+            uint64_t length = getVarint(p, end);
+            if (length > original) {
+                throw std::runtime_error("zstd: match longer than block");
+            }
+            length += MIN_MATCH;
+            checkRoom(out, original, length);
+            copyMatch(out, getVarint(p, end), length);
+        }
+        if (out.size() != original) {
+            throw std::runtime_error("zstd: size mismatch");
+        }
+    }
+
+private:
+    static constexpr unsigned HASH_BITS = 16;
+    static constexpr uint32_t WINDOW = 1u << 20;
+    static constexpr uint64_t RESERVE_RATIO = 8;
+
+    static uint32_t hash(uint32_t value) { return (value * 2654435761u) >> (32 - HASH_BITS); }
+
+    uint32_t position(const unsigned char* p) const { return currentBase_ + static_cast<uint32_t>(p - in_); }
+
+    void insert(const unsigned char* p) {
+        uint32_t& head = head_[hash(read32(p))];
+        uint32_t pos = position(p);
+        chain_[pos & (WINDOW - 1)] = head;
+        head = pos;
+    }
+
+    // Walks the chain for the longest match at `p`, then links `p` in
+    std::size_t findAndInsert(const unsigned char* p, std::size_t& offset) {
+        uint32_t pos = position(p);
+        uint32_t candidate = head_[hash(read32(p))];
+        std::size_t best = 0;
+        for (unsigned i = 0; i < depth_ && candidate >= currentBase_ && pos - candidate < WINDOW; i++) {
+            const unsigned char* match = in_ + (candidate - currentBase_);
+            if (match[best] == p[best] || best == 0) {
+                std::size_t length = matchLength(match, p, end_);
+                if (length > best) {
+                    best = length;
+                    offset = pos - candidate;
+                    if (p + best == end_) {
+                        break;
+                    }
+                }
+            }
+            candidate = chain_[candidate & (WINDOW - 1)];
+        }
+        insert(p);
+        return best;
+    }
+
+    unsigned depth_;
+    std::vector<uint32_t> head_;
+    std::vector<uint32_t> chain_;
+    std::vector<unsigned char> literals_;
+    std::vector<char> sequences_;
+    const unsigned char* in_ = nullptr;
+    const unsigned char* end_ = nullptr;
+    uint32_t currentBase_ = 0;
+};
+
+}
+
+std::unique_ptr<Codec> createCodec(const std::string& name) {
+    if (name.empty() || name == "none") {
+        return std::make_unique<NoneCodec>();
+    }
+    if (name == "lz4") {
+        return std::make_unique<FastLzCodec>();
+    }
+    if (name == "zstd") {
+        return std::make_unique<DeepLzCodec>();
+    }
+    throw std::invalid_argument("createCodec: unknown compression '" + name + "'");
+}
+
+void CompressionStats::merge(const CompressionStats& other) {
+    batches += other.batches;
+    inputBytes += other.inputBytes;
+    outputBytes += other.outputBytes;
+    nanos += other.nanos;
+}
+
+CompressionStage::CompressionStage(const std::string& codecName) {
+    auto codec = createCodec(codecName);
+    if (codec->name() != "none") {
+        codec_ = std::move(codec);
+    }
+}
+
+uint64_t CompressionStage::process(RecordBatch& batch) {
+    if (!codec_) {
+        return 0;
+    }
+    auto begin = std::chrono::steady_clock::now();
+    framed_.clear();
+    for (const auto& record : batch.records()) {
+        char header[sizeof(uint32_t)];
+        std::memcpy(header, &record.size, sizeof(header));
+        framed_.insert(framed_.end(), header, header + sizeof(header));
+        framed_.insert(framed_.end(), record.data, record.data + record.size);
+    }
+    codec_->compress(framed_.data(), framed_.size(), batch.encoded());
+    uint64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+
+    stats_.batches++;
+    stats_.inputBytes += framed_.size();
+    stats_.outputBytes += batch.encoded().size();
+    stats_.nanos += nanos;
+    return nanos;
+}
+
+std::vector<std::string> CompressionStage::unframe(const std::vector<char>& framed) {
+    std::vector<std::string> records;
+    std::size_t pos = 0;
+    while (pos + sizeof(uint32_t) <= framed.size()) {
+        uint32_t size;
+        std::memcpy(&size, framed.data() + pos, sizeof(size));
+        pos += sizeof(size);
+        if (pos + size > framed.size()) {
+            throw std::runtime_error("CompressionStage: truncated record");
+        }
+        records.emplace_back(framed.data() + pos, size);
+        pos += size;
+    }
+    if (pos != framed.size()) {
+        throw std::runtime_error("CompressionStage: trailing bytes");
+    }
+    return records;
+}
+
+} // namespace loadtest
@@ -0,0 +1,413 @@
+#include "config.hpp"
+#include "compression.hpp"
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <stdexcept>
+
+namespace loadtest {
+
+namespace {
+
+// Assigns `out` only when `key` is present, so later files override
+// earlier ones field by field
+template <typename T>
+void read(const YAML::Node& node, const char* key, T& out) {
+    const YAML::Node value = node[key];
+    if (value && !value.IsNull()) {
+        out = value.as<T>();
+    }
+}
+
+// Integer in `unit`s, or a string with an ms/s/m/h suffix
+template <typename Duration>
+void readDuration(const YAML::Node& node, const char* key, Duration& out) {
+    const YAML::Node value = node[key];
+    if (!value || value.IsNull()) {
+        return;
+    }
+    std::string text = value.as<std::string>();
+    std::size_t digits = 0;
+    while (digits < text.size() && std::isdigit(static_cast<unsigned char>(text[digits]))) {
+        digits++;
+    }
+    if (digits == 0) {
+        throw std::invalid_argument(std::string(key) + ": expected a duration, got '" + text + "'");
+    }
+    int64_t amount = std::stoll(text.substr(0, digits));
+    std::string unit = text.substr(digits);
+    std::chrono::milliseconds millis;
+    if (unit.empty()) {
+        out = Duration(amount);
+        return;
+    } else if (unit == "ms") {
+        millis = std::chrono::milliseconds(amount);
+    } else if (unit == "s") {
+        millis = std::chrono::seconds(amount);
+    } else if (unit == "m") {
+        millis = std::chrono::minutes(amount);
+    } else if (unit == "h") {
+        millis = std::chrono::hours(amount);
+    } else {
+        throw std::invalid_argument(std::string(key) + ": unknown duration unit '" + unit + "'");
+    }
+    out = std::chrono::duration_cast<Duration>(millis);
+}
+
+void readEndpoint(const YAML::Node& node, Endpoint& endpoint) {
+    read(node, "name", endpoint.name);
+    read(node, "url", endpoint.url);
+    read(node, "method", endpoint.method);
+    read(node, "headers", endpoint.headers);
+    read(node, "body", endpoint.body);
+    read(node, "timeout", endpoint.timeout);
+    read(node, "retries", endpoint.retries);
+}
+
+bool isLogLevel(const std::string& level) {
+    static const char* levels[] = {"trace", "debug", "info", "warn", "error", "critical", "off"};
+    return std::find(std::begin(levels), std::end(levels), level) != std::end(levels);
+}
+
+std::string lowercase(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return text;
+}
+
+}
+
+Config::Config() : jobs_(1), length_(0) {
+    setDefaults();
+}
+
+Config::~Config() = default;
+
+bool Config::loadFromFiles(const std::vector<std::string>& configFiles) {
+    setDefaults();
+    validationErrors_.clear();
+    if (configFiles.empty()) {
+        validationErrors_.push_back("no configuration files given");
+    }
+    for (const auto& file : configFiles) {
+        try {
+            // The document is only needed while copying it into the typed
+            // structs; nothing keeps the YAML tree alive afterwards
+            if (!parseYamlNode(YAML::LoadFile(file))) {
+                break;
+            }
+        } catch (const YAML::Exception& e) {
+            validationErrors_.push_back(file + ": " + e.what());
+            break;
+        }
+    }
+    configNode_ = YAML::Node();
+    for (const auto& error : validationErrors_) {
+        spdlog::error("config: {}", error);
+    }
+    return validationErrors_.empty() && validate();
+}
+
+bool Config::loadFromYaml(const std::string& yamlContent) {
+    setDefaults();
+    validationErrors_.clear();
+    try {
+        parseYamlNode(YAML::Load(yamlContent));
+    } catch (const YAML::Exception& e) {
+        validationErrors_.push_back(e.what());
+    }
+    configNode_ = YAML::Node();
+    for (const auto& error : validationErrors_) {
+        spdlog::error("config: {}", error);
+    }
+    return validationErrors_.empty() && validate();
+}
+
+std::shared_ptr<ClientOpts> Config::getClientOpts() const {
+    return clientOpts_;
+}
+
+bool Config::validate() const {
+    return getValidationErrors().empty();
+}
+
+std::vector<std::string> Config::getValidationErrors() const {
+    std::vector<std::string> errors = validationErrors_;  // parse errors first
+
+    if (endpoints_.empty()) {
+        errors.push_back("endpoints: at least one endpoint is required");
+    }
+    for (const auto& endpoint : endpoints_) {
+        if (endpoint.empty()) {
+            errors.push_back("endpoints: empty endpoint");
+        }
+    }
+    if (jobs_ == 0) {
+        errors.push_back("jobs: must be at least 1");
+    }
+    if (length_.count() <= 0) {
+        errors.push_back("length: must be positive");
+    }
+    if (authMode_ != "none" && authMode_ != "tls" && authMode_ != "mtls") {
+        errors.push_back("authMode: expected none, tls or mtls, got '" + authMode_ + "'");
+    } else if (!validateTLSFiles()) {
+        errors.push_back("authMode: " + authMode_ + " requires readable certificate, privateKey and caCert files");
+    }
+
+    if (producer_.parallelism < 1 || producer_.producersPerPod < 1) {
+        errors.push_back("producer: parallelism and producersPerPod must be at least 1");
+    }
+    if (producer_.batchCount < 1) {
+        errors.push_back("producer.batchCount: must be at least 1");
+    }
+    if (producer_.messageSize == 0) {
+        errors.push_back("producer.messageSize: must be at least 1 byte");
+    }
+    if (producer_.maxBytes != 0 && producer_.maxBytes < producer_.messageSize) {
+        errors.push_back("producer.maxBytes: smaller than one message");
+    }
+    if (producer_.count < 0 || producer_.maxBufferedRecords < 0) {
+        errors.push_back("producer: count and maxBufferedRecords cannot be negative");
+    }
+    if (producer_.lingerMs.count() < 0) {
+        errors.push_back("producer.lingerMs: cannot be negative");
+    }
+    try {
+        createCodec(producer_.compression);
+    } catch (const std::invalid_argument&) {
+        errors.push_back("producer.compression: expected none, lz4 or zstd, got '" + producer_.compression + "'");
+    }
+
+    if (consumer_.pods < 1 || consumer_.consumersPerPod < 1) {
+        errors.push_back("consumer: pods and consumersPerPod must be at least 1");
+    }
+    if (consumer_.maxBatchSize < 1) {
+        errors.push_back("consumer.maxBatchSize: must be at least 1");
+    }
+
+    if (!metrics_.format.empty() && metrics_.format != "json" && metrics_.format != "csv") {
+        errors.push_back("metrics.format: expected json or csv, got '" + metrics_.format + "'");
+    }
+    if (!isLogLevel(controller_.logLevel)) {
+        errors.push_back("controller.logLevel: unknown level '" + controller_.logLevel + "'");
+    }
+    if (!isLogLevel(logging_.level)) {
+        errors.push_back("logging.level: unknown level '" + logging_.level + "'");
+    }
+    if (logging_.format != "json" && logging_.format != "text") {
+        errors.push_back("logging.format: expected json or text, got '" + logging_.format + "'");
+    }
+    return errors;
+}
+
+bool Config::parseYamlNode(const YAML::Node& node) {
+    if (!node.IsMap()) {
+        validationErrors_.push_back("configuration root must be a mapping");
+        return false;
+    }
+    // Each section is parsed on its own so one bad value does not hide
+    // errors in the others
+    auto section = [&](const char* name, auto parse) {
+        try {
+            parse();
+        } catch (const std::exception& e) {
+            validationErrors_.push_back(std::string(name) + ": " + e.what());
+        }
+    };
+
+    section("top level", [&] {
+        const YAML::Node endpoints = node["endpoints"];
+        if (endpoints && endpoints.IsScalar()) {
+            endpoints_ = {endpoints.as<std::string>()};
+        } else {
+            read(node, "endpoints", endpoints_);
+        }
+        read(node, "mode", mode_);
+        read(node, "authMode", authMode_);
+        read(node, "certificate", certificate_);
+        read(node, "privateKey", privateKey_);
+        read(node, "caCert", caCert_);
+        read(node, "jobs", jobs_);
+        readDuration(node, "length", length_);
+    });
+    if (const YAML::Node pods = node["pods"]) {
+        section("pods", [&] {
+            read(pods, "labels", pods_.labels);
+            read(pods, "annotations", pods_.annotations);
+            read(pods, "name", pods_.name);
+            read(pods, "namespace", pods_.namespace_);
+            read(pods, "serviceAccountName", pods_.serviceAccountName);
+            read(pods, "configMapName", pods_.configMapName);
+            read(pods, "image", pods_.image);
+            read(pods, "controllerCommand", pods_.controllerCommand);
+            read(pods, "producerCommand", pods_.producerCommand);
+            read(pods, "consumerCommand", pods_.consumerCommand);
+            read(pods, "resources", pods_.resources);
+        });
+    }
+    if (const YAML::Node controller = node["controller"]) {
+        section("controller", [&] {
+            read(controller, "recordDirectory", controller_.recordDirectory);
+            read(controller, "logLevel", controller_.logLevel);
+        });
+    }
+    if (const YAML::Node adminClient = node["adminClient"]) {
+        section("adminClient", [&] {
+            read(adminClient, "certificate", adminClient_.certificate);
+            read(adminClient, "privateKey", adminClient_.privateKey);
+            read(adminClient, "authType", adminClient_.authType);
+        });
+    }
+    if (const YAML::Node producer = node["producer"]) {
+        section("producer", [&] {
+            if (const YAML::Node endpoint = producer["endpoint"]) {
+                readEndpoint(endpoint, producer_.endpoint);
+            }
+            read(producer, "useAsync", producer_.useAsync);
+            read(producer, "parallelism", producer_.parallelism);
+            read(producer, "producersPerPod", producer_.producersPerPod);
+            read(producer, "throughput", producer_.throughput);
+            read(producer, "batchCount", producer_.batchCount);
+            read(producer, "messageSize", producer_.messageSize);
+            read(producer, "maxBytes", producer_.maxBytes);
+            read(producer, "maxBufferedRecords", producer_.maxBufferedRecords);
+            read(producer, "count", producer_.count);
+            read(producer, "compression", producer_.compression);
+            read(producer, "contentType", producer_.contentType);
+            readDuration(producer, "lingerMs", producer_.lingerMs);
+            read(producer, "staticValue", producer_.staticValue);
+            read(producer, "staticContent", producer_.staticContent);
+            read(producer, "retryPolicy", producer_.retryPolicy);
+            read(producer, "producerConfig", producer_.producerConfig);
+        });
+    }
+    if (const YAML::Node consumer = node["consumer"]) {
+        section("consumer", [&] {
+            read(consumer, "ignoreErrors", consumer_.ignoreErrors);
+            read(consumer, "pods", consumer_.pods);
+            read(consumer, "consumersPerPod", consumer_.consumersPerPod);
+            if (const YAML::Node mode = consumer["mode"]) {
+                consumer_.mode = stringToConsumerMode(mode.as<std::string>());
+            }
+            read(consumer, "consumerGroupName", consumer_.consumerGroupName);
+            read(consumer, "maxBatchSize", consumer_.maxBatchSize);
+            read(consumer, "endpoint", consumer_.endpoint);
+            read(consumer, "protocol", consumer_.protocol);
+        });
+    }
+    if (const YAML::Node metrics = node["metrics"]) {
+        section("metrics", [&] {
+            read(metrics, "endpoint", metrics_.endpoint);
+            read(metrics, "format", metrics_.format);
+        });
+    }
+    if (const YAML::Node events = node["events"]) {
+        section("events", [&] {
+            read(events, "topic", events_.topic);
+            read(events, "broker", events_.broker);
+            read(events, "format", events_.format);
+        });
+    }
+    if (const YAML::Node logging = node["logging"]) {
+        section("logging", [&] {
+            read(logging, "level", logging_.level);
+            read(logging, "format", logging_.format);
+            if (const YAML::Node components = logging["components"]) {
+                read(components, "producer", logging_.components.producer);
+                read(components, "consumer", logging_.components.consumer);
+            }
+        });
+    }
+    return validationErrors_.empty();
+}
+
+bool Config::validateTLSFiles() const {
+    if (authMode_ == "none") {
+        return true;
+    }
+    for (const std::string* path : {&certificate_, &privateKey_, &caCert_}) {
+        std::error_code error;
+        if (path->empty() || !std::filesystem::is_regular_file(*path, error)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Config::setDefaults() {
+    endpoints_.clear();
+    mode_ = "producer";
+    authMode_ = "none";
+    certificate_.clear();
+    privateKey_.clear();
+    caCert_.clear();
+    jobs_ = 1;
+    length_ = std::chrono::seconds(60);
+
+    pods_ = PodSpec{};
+    controller_ = Controller{"./records", "info"};
+    adminClient_ = AdminClient{};
+
+    producer_ = Producer{};
+    producer_.endpoint.method = "POST";
+    producer_.endpoint.timeout = 30000;
+    producer_.endpoint.retries = 0;
+    producer_.useAsync = false;
+    producer_.parallelism = 1;
+    producer_.producersPerPod = 1;
+    producer_.throughput = 0;
+    producer_.batchCount = 100;
+    producer_.messageSize = 1024;
+    producer_.maxBytes = 0;
+    producer_.maxBufferedRecords = 10000;
+    producer_.count = 0;
+    producer_.compression = "none";
+    producer_.contentType = "application/octet-stream";
+    producer_.lingerMs = std::chrono::milliseconds(5);
+    producer_.staticValue = false;
+    producer_.retryPolicy = "none";
+
+    consumer_ = Consumer{};
+    consumer_.ignoreErrors = false;
+    consumer_.pods = 1;
+    consumer_.consumersPerPod = 1;
+    consumer_.mode = ConsumerMode::SHARED;
+    consumer_.maxBatchSize = 100;
+    consumer_.protocol = "tcp";
+
+    metrics_ = Metrics{"", "json"};
+    events_ = Events{};
+    logging_ = Logging{};
+    logging_.level = "info";
+    logging_.format = "text";
+}
+
+std::string consumerModeToString(ConsumerMode mode) {
+    switch (mode) {
+        case ConsumerMode::FANOUT:
+            return "FANOUT";
+        case ConsumerMode::SHARED:
+            return "SHARED";
+        case ConsumerMode::ROUND_ROBIN:
+            return "ROUND_ROBIN";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+ConsumerMode stringToConsumerMode(const std::string& str) {
+    std::string mode = lowercase(str);
+    std::replace(mode.begin(), mode.end(), '-', '_');
+    if (mode == "fanout") {
+        return ConsumerMode::FANOUT;
+    }
+    if (mode == "shared") {
+        return ConsumerMode::SHARED;
+    }
+    if (mode == "round_robin" || mode == "roundrobin") {
+        return ConsumerMode::ROUND_ROBIN;
+    }
+    throw std::invalid_argument("unknown consumer mode '" + str + "'");
+}
+
+} // namespace loadtest
@@ -0,0 +1,380 @@
+#include "config_snapshot.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+
+namespace loadtest {
+
+namespace {
+
+constexpr char MAGIC[8] = {'L', 'T', 'C', 'F', 'G', 'S', 'N', 'P'};
+constexpr uint32_t VERSION = 1;
+constexpr std::size_t HEADER_SIZE = 32;  // magic(8) version(4) pad(4) size(8) checksum(8)
+
+uint64_t checksum(const char* data, std::size_t length) {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < length; i++) {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+class Writer {
+public:
+    template <typename T>
+    void put(T value) {
+        static_assert(std::is_arithmetic<T>::value, "fixed-width fields only");
+        out_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    void put(const std::string& value) {
+        put<uint32_t>(static_cast<uint32_t>(value.size()));
+        out_.append(value);
+    }
+    void put(const std::vector<std::string>& values) {
+        put<uint32_t>(static_cast<uint32_t>(values.size()));
+        for (const auto& value : values) {
+            put(value);
+        }
+    }
+    template <typename V>
+    void put(const std::map<std::string, V>& values) {
+        put<uint32_t>(static_cast<uint32_t>(values.size()));
+        for (const auto& entry : values) {
+            put(entry.first);
+            put(entry.second);
+        }
+    }
+
+    std::string& bytes() { return out_; }
+
+private:
+    std::string out_;
+};
+
+class Reader {
+public:
+    Reader(const char* data, std::size_t size) : p_(data), end_(data + size) {}
+
+    template <typename T>
+    void get(T& value) {
+        static_assert(std::is_arithmetic<T>::value, "fixed-width fields only");
+        need(sizeof(value));
+        std::memcpy(&value, p_, sizeof(value));
+        p_ += sizeof(value);
+    }
+    void get(std::string& value) {
+        uint32_t size;
+        get(size);
+        need(size);
+        value.assign(p_, size);
+        p_ += size;
+    }
+    void get(std::vector<std::string>& values) {
+        uint32_t count;
+        get(count);
+        values.resize(count);
+        for (auto& value : values) {
+            get(value);
+        }
+    }
+    template <typename V>
+    void get(std::map<std::string, V>& values) {
+        uint32_t count;
+        get(count);
+        values.clear();
+        for (uint32_t i = 0; i < count; i++) {
+            std::string key;
+            get(key);
+            get(values[key]);
+        }
+    }
+
+    bool done() const { return p_ == end_; }
+
+private:
+    void need(std::size_t bytes) const {
+        if (static_cast<std::size_t>(end_ - p_) < bytes) {
+            throw std::runtime_error("ConfigSnapshot: truncated payload");
+        }
+    }
+
+    const char* p_;
+    const char* end_;
+};
+
+// Read-only mapping of a whole file, unmapped on scope exit
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) : data_(nullptr), size_(0) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("ConfigSnapshot: cannot open " + path);
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw std::runtime_error("ConfigSnapshot: cannot stat " + path);
+        }
+        size_ = static_cast<std::size_t>(info.st_size);
+        if (size_ > 0) {
+            void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("ConfigSnapshot: cannot map " + path);
+            }
+            data_ = static_cast<const char*>(mapped);
+        }
+        ::close(fd);
+    }
+    ~MappedFile() {
+        if (data_) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return data_; }
+    std::size_t size() const { return size_; }
+
+private:
+    const char* data_;
+    std::size_t size_;
+};
+
+}
+
+// encode() and decode() must list the fields in the same order; bump
+// VERSION whenever that order or a field's width changes
+std::string ConfigSnapshot::encode(const Config& c) {
+    Writer w;
+    w.put(c.endpoints_);
+    w.put(c.mode_);
+    w.put(c.authMode_);
+    w.put(c.certificate_);
+    w.put(c.privateKey_);
+    w.put(c.caCert_);
+    w.put(c.jobs_);
+    w.put<int64_t>(c.length_.count());
+
+    w.put(c.pods_.labels);
+    w.put(c.pods_.annotations);
+    w.put(c.pods_.name);
+    w.put(c.pods_.namespace_);
+    w.put(c.pods_.serviceAccountName);
+    w.put(c.pods_.configMapName);
+    w.put(c.pods_.image);
+    w.put(c.pods_.controllerCommand);
+    w.put(c.pods_.producerCommand);
+    w.put(c.pods_.consumerCommand);
+    w.put(c.pods_.resources);
+
+    w.put(c.controller_.recordDirectory);
+    w.put(c.controller_.logLevel);
+    w.put(c.adminClient_.certificate);
+    w.put(c.adminClient_.privateKey);
+    w.put(c.adminClient_.authType);
+
+    const Producer& p = c.producer_;
+    w.put(p.endpoint.name);
+    w.put(p.endpoint.url);
+    w.put(p.endpoint.method);
+    w.put(p.endpoint.headers);
+    w.put(p.endpoint.body);
+    w.put(p.endpoint.timeout);
+    w.put(p.endpoint.retries);
+    w.put<uint8_t>(p.useAsync);
+    w.put(p.parallelism);
+    w.put<int32_t>(p.producersPerPod);
+    w.put(p.throughput);
+    w.put<uint32_t>(p.batchCount);
+    w.put(p.messageSize);
+    w.put(p.maxBytes);
+    w.put<int32_t>(p.maxBufferedRecords);
+    w.put<int32_t>(p.count);
+    w.put(p.compression);
+    w.put(p.contentType);
+    w.put<int64_t>(p.lingerMs.count());
+    w.put<uint8_t>(p.staticValue);
+    w.put(p.staticContent);
+    w.put(p.retryPolicy);
+    w.put(p.producerConfig);
+
+    const Consumer& k = c.consumer_;
+    w.put<uint8_t>(k.ignoreErrors);
+    w.put<int32_t>(k.pods);
+    w.put<int32_t>(k.consumersPerPod);
+    w.put<uint8_t>(static_cast<uint8_t>(k.mode));
+    w.put(k.consumerGroupName);
+    w.put(k.maxBatchSize);
+    w.put(k.endpoint);
+    w.put(k.protocol);
+
+    w.put(c.metrics_.endpoint);
+    w.put(c.metrics_.format);
+    w.put(c.events_.topic);
+    w.put(c.events_.broker);
+    w.put(c.events_.format);
+    w.put(c.logging_.level);
+    w.put(c.logging_.format);
+    w.put(c.logging_.components.producer);
+    w.put(c.logging_.components.consumer);
+
+    std::string payload = std::move(w.bytes());
+    std::string out(HEADER_SIZE, '\0');
+    uint64_t size = payload.size();
+    uint64_t sum = checksum(payload.data(), payload.size());
+    std::memcpy(&out[0], MAGIC, sizeof(MAGIC));
+    std::memcpy(&out[8], &VERSION, sizeof(VERSION));
+    std::memcpy(&out[16], &size, sizeof(size));
+    std::memcpy(&out[24], &sum, sizeof(sum));
+    return out + payload;
+}
+
+Config ConfigSnapshot::decode(const char* data, std::size_t size) {
+    if (size < HEADER_SIZE || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("ConfigSnapshot: not a config snapshot");
+    }
+    uint32_t version;
+    uint64_t payloadSize, sum;
+    std::memcpy(&version, data + 8, sizeof(version));
+    std::memcpy(&payloadSize, data + 16, sizeof(payloadSize));
+    std::memcpy(&sum, data + 24, sizeof(sum));
+    if (version != VERSION) {
+        throw std::runtime_error("ConfigSnapshot: unsupported version " + std::to_string(version));
+    }
+    if (payloadSize != size - HEADER_SIZE || checksum(data + HEADER_SIZE, payloadSize) != sum) {
+        throw std::runtime_error("ConfigSnapshot: checksum mismatch");
+    }
+
+    Config c;
+    Reader r(data + HEADER_SIZE, payloadSize);
+    int64_t length, linger;
+    uint8_t useAsync, staticValue, ignoreErrors, mode;
+    int32_t producersPerPod, maxBufferedRecords, count, pods, consumersPerPod;
+    uint32_t batchCount;
+
+    r.get(c.endpoints_);
+    r.get(c.mode_);
+    r.get(c.authMode_);
+    r.get(c.certificate_);
+    r.get(c.privateKey_);
+    r.get(c.caCert_);
+    r.get(c.jobs_);
+    r.get(length);
+    c.length_ = std::chrono::seconds(length);
+
+    r.get(c.pods_.labels);
+    r.get(c.pods_.annotations);
+    r.get(c.pods_.name);
+    r.get(c.pods_.namespace_);
+    r.get(c.pods_.serviceAccountName);
+    r.get(c.pods_.configMapName);
+    r.get(c.pods_.image);
+    r.get(c.pods_.controllerCommand);
+    r.get(c.pods_.producerCommand);
+    r.get(c.pods_.consumerCommand);
+    r.get(c.pods_.resources);
+
+    r.get(c.controller_.recordDirectory);
+    r.get(c.controller_.logLevel);
+    r.get(c.adminClient_.certificate);
+    r.get(c.adminClient_.privateKey);
+    r.get(c.adminClient_.authType);
+
+    Producer& p = c.producer_;
+    r.get(p.endpoint.name);
+    r.get(p.endpoint.url);
+    r.get(p.endpoint.method);
+    r.get(p.endpoint.headers);
+    r.get(p.endpoint.body);
+    r.get(p.endpoint.timeout);
+    r.get(p.endpoint.retries);
+    r.get(useAsync);
+    r.get(p.parallelism);
+    r.get(producersPerPod);
+    r.get(p.throughput);
+    r.get(batchCount);
+    r.get(p.messageSize);
+    r.get(p.maxBytes);
+    r.get(maxBufferedRecords);
+    r.get(count);
+    r.get(p.compression);
+    r.get(p.contentType);
+    r.get(linger);
+    r.get(staticValue);
+    r.get(p.staticContent);
+    r.get(p.retryPolicy);
+    r.get(p.producerConfig);
+    p.useAsync = useAsync != 0;
+    p.producersPerPod = producersPerPod;
+    p.batchCount = batchCount;
+    p.maxBufferedRecords = maxBufferedRecords;
+    p.count = count;
+    p.lingerMs = std::chrono::milliseconds(linger);
+    p.staticValue = staticValue != 0;
+
+    Consumer& k = c.consumer_;
+    r.get(ignoreErrors);
+    r.get(pods);
+    r.get(consumersPerPod);
+    r.get(mode);
+    r.get(k.consumerGroupName);
+    r.get(k.maxBatchSize);
+    r.get(k.endpoint);
+    r.get(k.protocol);
+    if (mode > static_cast<uint8_t>(ConsumerMode::ROUND_ROBIN)) {
+        throw std::runtime_error("ConfigSnapshot: invalid consumer mode");
+    }
+    k.ignoreErrors = ignoreErrors != 0;
+    k.pods = pods;
+    k.consumersPerPod = consumersPerPod;
+    k.mode = static_cast<ConsumerMode>(mode);
+
+    r.get(c.metrics_.endpoint);
+    r.get(c.metrics_.format);
+    r.get(c.events_.topic);
+    r.get(c.events_.broker);
+    r.get(c.events_.format);
+    r.get(c.logging_.level);
+    r.get(c.logging_.format);
+    r.get(c.logging_.components.producer);
+    r.get(c.logging_.components.consumer);
+    if (!r.done()) {
+        throw std::runtime_error("ConfigSnapshot: trailing bytes");
+    }
+    return c;
+}
+
+void ConfigSnapshot::write(const Config& config, const std::string& path) {
+    if (!config.validate()) {
+        throw std::invalid_argument("ConfigSnapshot: refusing to snapshot an invalid config");
+    }
+    std::string bytes = encode(config);
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        if (!out) {
+            throw std::runtime_error("ConfigSnapshot: cannot write " + temporary);
+        }
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        throw std::runtime_error("ConfigSnapshot: cannot rename " + temporary + " to " + path);
+    }
+}
+
+Config ConfigSnapshot::load(const std::string& path) {
+    MappedFile file(path);
+    return decode(file.data(), file.size());
+}
+
+} // namespace loadtest
@@ -0,0 +1,90 @@
+#include "config_watcher.hpp"
+#include <stdexcept>
+
+namespace loadtest {
+
+ConfigWatcher::ConfigWatcher(std::vector<std::string> files, std::chrono::milliseconds pollInterval)
+    : files_(std::move(files)), pollInterval_(pollInterval), version_(0), rejected_(0), running_(false) {
+    if (pollInterval_.count() <= 0) {
+        throw std::invalid_argument("ConfigWatcher: pollInterval must be positive");
+    }
+    lastSignature_ = signature();
+    auto config = std::make_shared<Config>();
+    if (!config->loadFromFiles(files_)) {
+        throw std::invalid_argument("ConfigWatcher: initial configuration is invalid");
+    }
+    std::atomic_store(&current_, std::shared_ptr<const Config>(std::move(config)));
+    version_.store(1, std::memory_order_release);
+}
+
+ConfigWatcher::~ConfigWatcher() {
+    stop();
+}
+
+void ConfigWatcher::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    thread_ = std::thread(&ConfigWatcher::loop, this);
+}
+
+void ConfigWatcher::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    wake_.notify_one();
+    thread_.join();
+}
+
+bool ConfigWatcher::poll() {
+    std::lock_guard<std::mutex> lock(pollMutex_);
+    Signature now = signature();
+    if (now == lastSignature_) {
+        return false;
+    }
+    // Remember the attempt either way so a broken edit is reported once
+    lastSignature_ = now;
+    auto config = std::make_shared<Config>();
+    if (!config->loadFromFiles(files_)) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        for (const auto& error : config->getValidationErrors()) {
+            spdlog::warn("config reload rejected: {}", error);
+        }
+        return false;
+    }
+    std::atomic_store(&current_, std::shared_ptr<const Config>(std::move(config)));
+    version_.fetch_add(1, std::memory_order_release);
+    spdlog::info("config reloaded (version {})", getVersion());
+    return true;
+}
+
+ConfigWatcher::Signature ConfigWatcher::signature() const {
+    Signature result;
+    for (const auto& file : files_) {
+        std::error_code error;
+        auto time = std::filesystem::last_write_time(file, error);
+        auto size = error ? 0 : std::filesystem::file_size(file, error);
+        result.emplace_back(error ? std::filesystem::file_time_type::min() : time, error ? 0 : size);
+    }
+    return result;
+}
+
+void ConfigWatcher::loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        if (wake_.wait_for(lock, pollInterval_, [this] { return !running_; })) {
+            return;
+        }
+        lock.unlock();
+        poll();
+        lock.lock();
+    }
+}
+
+} // namespace loadtest
@@ -0,0 +1,116 @@
+#include "consumer.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace loadtest {
+
+ConsumerEngine::ConsumerEngine(const Consumer& config, std::shared_ptr<InMemoryBroker> broker)
+    : config_(config), broker_(std::move(broker)), failed_(false) {
+    if (!broker_) {
+        throw std::invalid_argument("ConsumerEngine: broker is required");
+    }
+    if (config_.pods < 1 || config_.consumersPerPod < 1 || config_.maxBatchSize < 1) {
+        throw std::invalid_argument("ConsumerEngine: pods, consumersPerPod and maxBatchSize must be at least 1");
+    }
+    if (config_.pods * config_.consumersPerPod != broker_->getConsumers() || config_.mode != broker_->getMode()) {
+        throw std::invalid_argument("ConsumerEngine: broker was built for a different consumer layout");
+    }
+}
+
+ConsumerEngine::~ConsumerEngine() {
+    if (!threads_.empty()) {
+        failed_.store(true, std::memory_order_relaxed);
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+}
+
+void ConsumerEngine::start() {
+    if (!threads_.empty()) {
+        throw std::logic_error("ConsumerEngine: already started");
+    }
+    int consumers = config_.pods * config_.consumersPerPod;
+    results_.assign(consumers, ConsumerStats{});
+    startTime_ = std::chrono::steady_clock::now();
+    for (int i = 0; i < consumers; i++) {
+        threads_.emplace_back(&ConsumerEngine::runConsumer, this, i, std::ref(results_[i]));
+    }
+}
+
+ConsumerStats ConsumerEngine::join() {
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+    threads_.clear();
+    if (error_) {
+        std::rethrow_exception(error_);
+    }
+
+    ConsumerStats stats;
+    stats.minRecords = results_.empty() ? 0 : results_.front().records;
+    for (const auto& result : results_) {
+        stats.records += result.records;
+        stats.batches += result.batches;
+        stats.errors += result.errors;
+        stats.minRecords = std::min(stats.minRecords, result.records);
+        stats.maxRecords = std::max(stats.maxRecords, result.records);
+    }
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime_).count();
+    return stats;
+}
+
+void ConsumerEngine::runConsumer(int index, ConsumerStats& stats) {
+    const std::size_t maxBatch = static_cast<std::size_t>(config_.maxBatchSize);
+    std::vector<BrokerMessage> batch(maxBatch);
+    std::shared_ptr<ThreadRecorder> recorder = metrics_ ? metrics_->createRecorder() : nullptr;
+
+    while (!failed_.load(std::memory_order_relaxed)) {
+        std::size_t count = broker_->poll(index, batch.data(), maxBatch);
+        if (count == 0) {
+            // Anything sent before close() is visible after seeing it closed
+            if (broker_->isClosed()) {
+                count = broker_->poll(index, batch.data(), maxBatch);
+                if (count == 0) {
+                    return;
+                }
+            } else {
+                std::this_thread::yield();
+                continue;
+            }
+        }
+
+        stats.records += count;
+        stats.batches++;
+        if (recorder) {
+            int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+            for (std::size_t i = 0; i < count; i++) {
+                int64_t latency = now - batch[i].intendedNanos;
+                recorder->record(Stage::DELIVERY, latency > 0 ? static_cast<uint64_t>(latency) : 0);
+            }
+            recorder->add(Counter::RECORDS_CONSUMED, count);
+            recorder->add(Counter::BATCHES_CONSUMED, 1);
+        }
+        if (handler_) {
+            try {
+                handler_(index, batch.data(), count);
+            } catch (...) {
+                if (config_.ignoreErrors) {
+                    stats.errors++;
+                    continue;
+                }
+                std::lock_guard<std::mutex> lock(errorMutex_);
+                if (!error_) {
+                    error_ = std::current_exception();
+                }
+                failed_.store(true, std::memory_order_relaxed);
+                // Nothing will drain the rings now; release blocked producers
+                broker_->close();
+                return;
+            }
+        }
+    }
+}
+
+} // namespace loadtest
@@ -0,0 +1,109 @@
+#include "histogram.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace loadtest {
+
+LatencyHistogram::LatencyHistogram(int precisionBits, uint64_t maxValue)
+    : precisionBits_(precisionBits), maxValue_(maxValue), subBucketCount_(1ULL << precisionBits),
+      halfCount_(static_cast<std::size_t>(1) << (precisionBits - 1)), bucketCount_(0),
+      total_(0), sum_(0), min_(std::numeric_limits<uint64_t>::max()), max_(0) {
+    if (precisionBits < 2 || precisionBits > 16 || maxValue < subBucketCount_) {
+        throw std::invalid_argument("LatencyHistogram: precisionBits must be 2..16 and maxValue >= 2^precisionBits");
+    }
+    bucketCount_ = indexOf(maxValue) + 1;
+    counts_.reset(new std::atomic<uint64_t>[bucketCount_]);
+    for (std::size_t i = 0; i < bucketCount_; i++) {
+        counts_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::mergeFrom(const LatencyHistogram& other) {
+    if (other.bucketCount_ != bucketCount_ || other.precisionBits_ != precisionBits_) {
+        throw std::invalid_argument("LatencyHistogram: cannot merge histograms with different layouts");
+    }
+    for (std::size_t i = 0; i < bucketCount_; i++) {
+        uint64_t count = other.counts_[i].load(std::memory_order_relaxed);
+        if (count) {
+            bump(counts_[i], count);
+        }
+    }
+    bump(total_, other.count());
+    bump(sum_, other.sum_.load(std::memory_order_relaxed));
+    if (other.count()) {
+        min_.store(std::min(min_.load(std::memory_order_relaxed), other.min_.load(std::memory_order_relaxed)),
+                   std::memory_order_relaxed);
+        max_.store(std::max(max(), other.max()), std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::subtract(const LatencyHistogram& other) {
+    uint64_t remaining = 0;
+    std::size_t lowest = bucketCount_, highest = 0;
+    for (std::size_t i = 0; i < bucketCount_; i++) {
+        uint64_t mine = counts_[i].load(std::memory_order_relaxed);
+        uint64_t theirs = other.counts_[i].load(std::memory_order_relaxed);
+        uint64_t left = mine > theirs ? mine - theirs : 0;
+        counts_[i].store(left, std::memory_order_relaxed);
+        if (left) {
+            remaining += left;
+            lowest = std::min(lowest, i);
+            highest = i;
+        }
+    }
+    total_.store(remaining, std::memory_order_relaxed);
+    uint64_t sum = sum_.load(std::memory_order_relaxed);
+    uint64_t otherSum = other.sum_.load(std::memory_order_relaxed);
+    sum_.store(sum > otherSum ? sum - otherSum : 0, std::memory_order_relaxed);
+    // Exact extremes are lost for an interval; bucket bounds are the best estimate
+    min_.store(remaining ? valueOf(lowest) : std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    max_.store(remaining ? valueOf(highest) : 0, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::reset() {
+    for (std::size_t i = 0; i < bucketCount_; i++) {
+        counts_[i].store(0, std::memory_order_relaxed);
+    }
+    total_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::min() const {
+    return count() ? min_.load(std::memory_order_relaxed) : 0;
+}
+
+double LatencyHistogram::mean() const {
+    uint64_t n = count();
+    return n ? static_cast<double>(sum_.load(std::memory_order_relaxed)) / n : 0.0;
+}
+
+uint64_t LatencyHistogram::percentile(double percentile) const {
+    uint64_t n = count();
+    if (n == 0) {
+        return 0;
+    }
+    uint64_t rank = static_cast<uint64_t>(std::clamp(percentile, 0.0, 100.0) / 100.0 * n);
+    rank = std::max<uint64_t>(rank, 1);
+    uint64_t seen = 0;
+    for (std::size_t i = 0; i < bucketCount_; i++) {
+        seen += counts_[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return std::min(valueOf(i), max());
+        }
+    }
+    return max();
+}
+
+uint64_t LatencyHistogram::valueOf(std::size_t index) const {
+    if (index < subBucketCount_) {
+        return index;
+    }
+    std::size_t shift = index / halfCount_ - 1;
+    uint64_t sub = index - shift * halfCount_;
+    return sub << shift;
+}
+
+} // namespace loadtest
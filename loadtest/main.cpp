@@ -0,0 +1,332 @@
+#include "broker.hpp"
+#include "config.hpp"
+#include "config_snapshot.hpp"
+#include "config_watcher.hpp"
+#include "compression.hpp"
+#include "consumer.hpp"
+#include "histogram.hpp"
+#include "metrics.hpp"
+#include "producer.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+loadtest::Producer benchmarkProducer() {
+    loadtest::Producer producer{};
+    producer.useAsync = false;
+    producer.parallelism = static_cast<int32_t>(std::max(1u, std::thread::hardware_concurrency()));
+    producer.producersPerPod = 1;
+    producer.throughput = 0;  // unpaced
+    producer.batchCount = 1000;
+    producer.messageSize = 64;
+    producer.maxBytes = 0;
+    producer.maxBufferedRecords = 16000;
+    producer.count = 0;
+    producer.compression = "none";
+    producer.lingerMs = std::chrono::milliseconds(5);
+    producer.staticValue = false;
+    return producer;
+}
+
+void report(const std::string& name, const loadtest::ProducerStats& stats) {
+    std::cout << name << ": " << stats.records << " records in " << stats.batches << " batches, "
+              << static_cast<uint64_t>(stats.recordsPerSecond()) << " records/sec, max schedule lag "
+              << stats.maxLagNanos / 1000 << "us" << std::endl;
+}
+
+loadtest::Consumer benchmarkConsumer(loadtest::ConsumerMode mode) {
+    loadtest::Consumer consumer{};
+    consumer.ignoreErrors = false;
+    consumer.pods = 2;
+    consumer.consumersPerPod = 2;
+    consumer.mode = mode;
+    consumer.consumerGroupName = "loadtest";
+    consumer.maxBatchSize = 500;
+    return consumer;
+}
+
+// Producer -> in-memory broker -> consumers, end to end
+void runPipeline(loadtest::ConsumerMode mode, std::chrono::milliseconds duration) {
+    auto producer = benchmarkProducer();
+    auto consumer = benchmarkConsumer(mode);
+    auto broker = std::make_shared<loadtest::InMemoryBroker>(
+        mode, consumer.pods * consumer.consumersPerPod, producer.parallelism, 1 << 16);
+    loadtest::ConsumerEngine consumers(consumer, broker);
+    loadtest::ProducerEngine engine(producer, broker);
+
+    consumers.start();
+    loadtest::ProducerStats produced = engine.run(duration);
+    broker->close();
+    loadtest::ConsumerStats consumed = consumers.join();
+
+    std::cout << loadtest::consumerModeToString(mode) << ": produced " << produced.records << ", consumed " << consumed.records
+              << " (" << static_cast<uint64_t>(consumed.recordsPerSecond()) << "/sec, avg batch "
+              << static_cast<uint64_t>(consumed.averageBatch()) << ", per consumer " << consumed.minRecords
+              << ".." << consumed.maxRecords << ")" << std::endl;
+}
+
+// Every run() starts fresh worker threads; they must get the lanes the
+// previous run's threads used instead of running out of them
+void runRepeatedPipeline(std::chrono::milliseconds duration) {
+    auto producer = benchmarkProducer();
+    auto consumer = benchmarkConsumer(loadtest::ConsumerMode::ROUND_ROBIN);
+    auto broker = std::make_shared<loadtest::InMemoryBroker>(
+        consumer.mode, consumer.pods * consumer.consumersPerPod, producer.parallelism, 1 << 16);
+    loadtest::ConsumerEngine consumers(consumer, broker);
+    loadtest::ProducerEngine engine(producer, broker);
+
+    consumers.start();
+    uint64_t produced = 0;
+    for (int run = 0; run < 3; run++) {
+        produced += engine.run(duration / 3).records;
+    }
+    broker->close();
+    loadtest::ConsumerStats consumed = consumers.join();
+    std::cout << "Three runs on one broker: produced " << produced << ", consumed " << consumed.records << std::endl;
+}
+
+// A consumer handler that throws must not leave producers spinning on
+// full rings: the engine closes the broker, so the producer run ends early
+void runFailingPipeline(std::chrono::milliseconds duration) {
+    auto producer = benchmarkProducer();
+    auto consumer = benchmarkConsumer(loadtest::ConsumerMode::SHARED);
+    auto broker = std::make_shared<loadtest::InMemoryBroker>(
+        consumer.mode, consumer.pods * consumer.consumersPerPod, producer.parallelism, 1 << 10);
+    loadtest::ConsumerEngine consumers(consumer, broker);
+    consumers.setHandler([](int, const loadtest::BrokerMessage*, std::size_t) {
+        throw std::runtime_error("handler failed");
+    });
+    loadtest::ProducerEngine engine(producer, broker);
+
+    consumers.start();
+    loadtest::ProducerStats produced = engine.run(duration);
+    try {
+        consumers.join();
+    } catch (const std::exception& e) {
+        std::cout << "Consumer failure (" << e.what() << "): producer stopped after " << produced.seconds * 1000
+                  << " ms of " << duration.count() << " ms" << std::endl;
+    }
+}
+
+// JSON-like events with random fields: compressible, but not trivially
+std::string eventCorpus(std::size_t bytes) {
+    static const char* users[] = {"alice", "bob", "carol", "dave", "erin", "frank", "grace", "heidi"};
+    static const char* actions[] = {"view", "click", "purchase", "add_to_cart", "logout"};
+    std::mt19937_64 random(42);
+    std::string corpus;
+    while (corpus.size() < bytes) {
+        corpus += "{\"user\":\"" + std::string(users[random() % 8]) + "\",\"action\":\"" + actions[random() % 5]
+                + "\",\"ts\":" + std::to_string(1700000000000ULL + random() % 100000000)
+                + ",\"amount\":" + std::to_string(random() % 100000) + ",\"session\":\""
+                + std::to_string(random()) + "\"}\n";
+    }
+    corpus.resize(bytes);
+    return corpus;
+}
+
+// Compress 64 KiB blocks of the corpus with each codec and verify the round trip
+void benchmarkCodecs() {
+    const std::string corpus = eventCorpus(32 << 20);
+    const std::size_t block = 64 << 10;
+    for (const char* name : {"none", "lz4", "zstd"}) {
+        auto codec = loadtest::createCodec(name);
+        std::vector<char> encoded, decoded;
+        loadtest::CompressionStats stats;
+        double decodeSeconds = 0.0;
+        for (std::size_t offset = 0; offset < corpus.size(); offset += block) {
+            std::size_t size = std::min(block, corpus.size() - offset);
+            auto begin = std::chrono::steady_clock::now();
+            codec->compress(corpus.data() + offset, size, encoded);
+            auto middle = std::chrono::steady_clock::now();
+            codec->decompress(encoded.data(), encoded.size(), decoded);
+            decodeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - middle).count();
+            if (decoded.size() != size || std::memcmp(decoded.data(), corpus.data() + offset, size) != 0) {
+                throw std::runtime_error(std::string("codec round trip failed: ") + name);
+            }
+            stats.batches++;
+            stats.inputBytes += size;
+            stats.outputBytes += encoded.size();
+            stats.nanos += std::chrono::duration_cast<std::chrono::nanoseconds>(middle - begin).count();
+        }
+        std::cout << "Codec " << name << ": ratio " << stats.ratio() << ", compress "
+                  << stats.cpuMillisPerMB() << " ms/MB, decompress "
+                  << decodeSeconds * 1000 / (stats.inputBytes / 1048576.0) << " ms/MB" << std::endl;
+    }
+}
+
+const char* SAMPLE_CONFIG = R"(
+endpoints: [broker-0:9092, broker-1:9092, broker-2:9092]
+mode: producer
+authMode: none
+jobs: 4
+length: 5m
+pods:
+  name: loadtest
+  namespace: perf
+  image: loadtest:latest
+  labels: {app: loadtest, team: perf}
+  producerCommand: [loadtest_bench, --producer]
+  resources:
+    limits: {cpu: "2", memory: 2Gi}
+    requests: {cpu: "1", memory: 1Gi}
+controller:
+  recordDirectory: /var/lib/loadtest
+  logLevel: info
+producer:
+  endpoint: {name: ingest, url: "http://ingest:8080/v1/events", method: POST, timeout: 5000, retries: 3}
+  parallelism: 8
+  throughput: 200000
+  batchCount: 500
+  messageSize: 256
+  compression: lz4
+  lingerMs: 5ms
+consumer:
+  pods: 4
+  consumersPerPod: 2
+  mode: round_robin
+  maxBatchSize: 500
+metrics: {format: csv}
+logging: {level: info, format: json}
+)";
+
+// YAML parse vs. mmap'd snapshot, then a hot reload through the watcher
+void benchmarkConfigLoading() {
+    namespace fs = std::filesystem;
+    const int iterations = 2000;
+    fs::path directory = fs::temp_directory_path() / "loadtest-config";
+    fs::create_directories(directory);
+    std::string yamlPath = (directory / "loadtest.yaml").string();
+    std::string snapshotPath = (directory / "loadtest.snapshot").string();
+    std::ofstream(yamlPath) << SAMPLE_CONFIG;
+
+    auto begin = std::chrono::steady_clock::now();
+    loadtest::Config parsed;
+    for (int i = 0; i < iterations; i++) {
+        if (!parsed.loadFromFiles({yamlPath})) {
+            throw std::runtime_error("sample config failed to validate");
+        }
+    }
+    double parseMicros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+
+    loadtest::ConfigSnapshot::write(parsed, snapshotPath);
+    begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        loadtest::Config loaded = loadtest::ConfigSnapshot::load(snapshotPath);
+        if (loaded.getProducer().throughput != parsed.getProducer().throughput) {
+            throw std::runtime_error("snapshot round trip failed");
+        }
+    }
+    double snapshotMicros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+    if (loadtest::ConfigSnapshot::encode(loadtest::ConfigSnapshot::load(snapshotPath))
+        != loadtest::ConfigSnapshot::encode(parsed)) {
+        throw std::runtime_error("snapshot round trip failed");
+    }
+    std::cout << "Config load: YAML " << parseMicros / iterations << " us, snapshot "
+              << snapshotMicros / iterations << " us" << std::endl;
+
+    loadtest::ConfigWatcher watcher({yamlPath}, std::chrono::milliseconds(20));
+    loadtest::ConfigHandle handle(watcher);
+    watcher.start();
+    auto waitFor = [&](auto condition) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+        while (!condition() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    };
+    std::string edited = SAMPLE_CONFIG;
+    edited.replace(edited.find("throughput: 200000"), 18, "throughput: 350000");
+    std::ofstream(yamlPath) << edited;
+    waitFor([&] { return handle.get().getProducer().throughput == 350000; });
+    std::ofstream(yamlPath) << "producer: {parallelism: 0}\n";
+    waitFor([&] { return watcher.getRejected() > 0; });
+    watcher.stop();
+    std::cout << "Hot reload: version " << watcher.getVersion() << ", throughput "
+              << handle.get().getProducer().throughput << ", rejected " << watcher.getRejected() << std::endl;
+    fs::remove_all(directory);
+}
+
+// Cost of one histogram record() on the hot path
+double recordOverheadNanos() {
+    loadtest::ThreadRecorder recorder;
+    const uint64_t samples = 20000000;
+    auto begin = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < samples; i++) {
+        recorder.record(loadtest::Stage::END_TO_END, (i * 2654435761ULL) & 0xFFFFFF);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - begin;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / samples;
+}
+
+}
+
+int main() {
+    std::cout << "Load test harness" << std::endl;
+    const auto duration = std::chrono::milliseconds(1000);
+
+    {
+        auto sink = std::make_shared<loadtest::CountingSink>();
+        loadtest::ProducerEngine engine(benchmarkProducer(), sink);
+        report("Unpaced, generated payloads", engine.run(duration));
+    }
+    {
+        auto config = benchmarkProducer();
+        config.staticValue = true;
+        config.staticContent = std::string(64, 's');
+        auto sink = std::make_shared<loadtest::CountingSink>();
+        loadtest::ProducerEngine engine(config, sink);
+        report("Unpaced, static payload", engine.run(duration));
+    }
+    {
+        auto config = benchmarkProducer();
+        config.throughput = 2000000;
+        config.useAsync = true;
+        auto sink = std::make_shared<loadtest::CountingSink>();
+        loadtest::ProducerEngine engine(config, sink);
+        report("Paced at 2M/s, async", engine.run(duration));
+    }
+    {
+        std::cout << "Histogram record: " << recordOverheadNanos() << " ns/sample" << std::endl;
+
+        auto config = benchmarkProducer();
+        config.throughput = 1000000;
+        loadtest::Metrics metrics{"", "json"};
+        loadtest::Controller controller{"loadtest-metrics", "info"};
+        auto registry = std::make_shared<loadtest::MetricsRegistry>();
+        loadtest::MetricsExporter exporter(registry, metrics, controller, std::chrono::milliseconds(250));
+        loadtest::ProducerEngine engine(config, std::make_shared<loadtest::CountingSink>());
+        engine.setMetrics(registry);
+
+        exporter.start();
+        report("Paced at 1M/s, with metrics", engine.run(duration));
+        exporter.stop();
+        std::cout << "Metrics written to " << exporter.getPath() << std::endl;
+    }
+
+    benchmarkCodecs();
+    for (const char* codec : {"lz4", "zstd"}) {
+        auto config = benchmarkProducer();
+        config.compression = codec;
+        config.messageSize = 256;
+        loadtest::ProducerEngine engine(config, std::make_shared<loadtest::CountingSink>());
+        auto stats = engine.run(duration);
+        report(std::string("Unpaced, ") + codec + " batches", stats);
+        std::cout << "  wire " << stats.wireBytes << " of " << stats.bytes << " bytes, ratio "
+                  << stats.compression.ratio() << ", " << stats.compression.cpuMillisPerMB() << " ms/MB" << std::endl;
+    }
+
+    runPipeline(loadtest::ConsumerMode::SHARED, duration);
+    runPipeline(loadtest::ConsumerMode::ROUND_ROBIN, duration);
+    runPipeline(loadtest::ConsumerMode::FANOUT, duration);
+    runRepeatedPipeline(duration);
+    runFailingPipeline(duration);
+
+    benchmarkConfigLoading();
+    return 0;
+}
@@ -0,0 +1,227 @@
+#include "metrics.hpp"
+#include <filesystem>
+#include <stdexcept>
+
+namespace loadtest {
+
+namespace {
+
+LatencySummary summarize(const LatencyHistogram& histogram) {
+    LatencySummary summary;
+    summary.count = histogram.count();
+    summary.min = histogram.min();
+    summary.max = histogram.max();
+    summary.mean = histogram.mean();
+    summary.p50 = histogram.percentile(50.0);
+    summary.p90 = histogram.percentile(90.0);
+    summary.p99 = histogram.percentile(99.0);
+    summary.p999 = histogram.percentile(99.9);
+    return summary;
+}
+
+}
+
+std::string stageToString(Stage stage) {
+    switch (stage) {
+        case Stage::END_TO_END:
+            return "end_to_end";
+        case Stage::COMPRESS:
+            return "compress";
+        case Stage::SEND:
+            return "send";
+        case Stage::DELIVERY:
+            return "delivery";
+        default:
+            return "unknown";
+    }
+}
+
+std::string counterToString(Counter counter) {
+    switch (counter) {
+        case Counter::RECORDS_SENT:
+            return "records_sent";
+        case Counter::BATCHES_SENT:
+            return "batches_sent";
+        case Counter::BYTES_SENT:
+            return "bytes_sent";
+        case Counter::RECORDS_CONSUMED:
+            return "records_consumed";
+        case Counter::BATCHES_CONSUMED:
+            return "batches_consumed";
+        default:
+            return "unknown";
+    }
+}
+
+ThreadRecorder::ThreadRecorder() {
+    for (auto& histogram : histograms_) {
+        histogram = std::make_unique<LatencyHistogram>();
+    }
+}
+
+MetricsRegistry::MetricsRegistry() : previousTotals_{}, previousTime_(std::chrono::steady_clock::now()) {
+    for (auto& histogram : previous_) {
+        histogram = std::make_unique<LatencyHistogram>();
+    }
+}
+
+std::shared_ptr<ThreadRecorder> MetricsRegistry::createRecorder() {
+    auto recorder = std::make_shared<ThreadRecorder>();
+    std::lock_guard<std::mutex> lock(mutex_);
+    recorders_.push_back(recorder);
+    return recorder;
+}
+
+MetricsSnapshot MetricsRegistry::snapshot() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = std::chrono::steady_clock::now();
+    MetricsSnapshot result;
+    result.timestampMillis = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    result.intervalSeconds = std::chrono::duration<double>(now - previousTime_).count();
+
+    for (std::size_t s = 0; s < STAGE_COUNT; s++) {
+        // Cumulative merge, then subtract the previous cumulative state
+        auto cumulative = std::make_unique<LatencyHistogram>();
+        for (const auto& recorder : recorders_) {
+            cumulative->mergeFrom(recorder->getHistogram(static_cast<Stage>(s)));
+        }
+        LatencyHistogram interval;
+        interval.mergeFrom(*cumulative);
+        interval.subtract(*previous_[s]);
+        result.latency[s] = summarize(interval);
+        previous_[s] = std::move(cumulative);
+    }
+    for (std::size_t c = 0; c < COUNTER_COUNT; c++) {
+        uint64_t total = 0;
+        for (const auto& recorder : recorders_) {
+            total += recorder->getCounter(static_cast<Counter>(c));
+        }
+        result.totals[c] = total;
+        result.ratesPerSecond[c] = result.intervalSeconds > 0
+                                 ? (total - previousTotals_[c]) / result.intervalSeconds : 0.0;
+        previousTotals_[c] = total;
+    }
+    previousTime_ = now;
+    return result;
+}
+
+MetricsExporter::MetricsExporter(std::shared_ptr<MetricsRegistry> registry, const Metrics& metrics,
+                                 const Controller& controller, std::chrono::milliseconds interval)
+    : registry_(std::move(registry)), interval_(interval), csv_(false), running_(false) {
+    if (!registry_) {
+        throw std::invalid_argument("MetricsExporter: registry is required");
+    }
+    if (interval_.count() <= 0) {
+        throw std::invalid_argument("MetricsExporter: interval must be positive");
+    }
+    if (metrics.format == "csv") {
+        csv_ = true;
+    } else if (!metrics.format.empty() && metrics.format != "json") {
+        throw std::invalid_argument("MetricsExporter: unsupported format '" + metrics.format + "'");
+    }
+
+    std::filesystem::path directory = controller.recordDirectory.empty() ? "." : controller.recordDirectory;
+    std::filesystem::create_directories(directory);
+    path_ = (directory / (csv_ ? "metrics.csv" : "metrics.jsonl")).string();
+    bool writeHeader = csv_ && (!std::filesystem::exists(path_) || std::filesystem::file_size(path_) == 0);
+    out_.open(path_, std::ios::app);
+    if (!out_) {
+        throw std::runtime_error("MetricsExporter: cannot open " + path_);
+    }
+    if (writeHeader) {
+        out_ << "timestamp_ms,interval_s";
+        for (std::size_t c = 0; c < COUNTER_COUNT; c++) {
+            std::string name = counterToString(static_cast<Counter>(c));
+            out_ << ',' << name << ',' << name << "_per_sec";
+        }
+        for (std::size_t s = 0; s < STAGE_COUNT; s++) {
+            std::string name = stageToString(static_cast<Stage>(s));
+            for (const char* field : {"count", "min", "mean", "p50", "p90", "p99", "p999", "max"}) {
+                out_ << ',' << name << '_' << field;
+            }
+        }
+        out_ << '\n';
+    }
+}
+
+MetricsExporter::~MetricsExporter() {
+    stop();
+}
+
+void MetricsExporter::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    registry_->snapshot();  // start the first interval now
+    thread_ = std::thread(&MetricsExporter::loop, this);
+}
+
+void MetricsExporter::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    wake_.notify_one();
+    thread_.join();
+    write(registry_->snapshot());
+}
+
+void MetricsExporter::loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto next = std::chrono::steady_clock::now() + interval_;
+    while (running_) {
+        if (wake_.wait_until(lock, next, [this] { return !running_; })) {
+            return;
+        }
+        next += interval_;
+        lock.unlock();
+        write(registry_->snapshot());
+        lock.lock();
+    }
+}
+
+void MetricsExporter::write(const MetricsSnapshot& snapshot) {
+    if (csv_) {
+        writeCsv(snapshot);
+    } else {
+        writeJson(snapshot);
+    }
+    out_.flush();
+}
+
+void MetricsExporter::writeJson(const MetricsSnapshot& snapshot) {
+    out_ << "{\"timestamp_ms\":" << snapshot.timestampMillis << ",\"interval_s\":" << snapshot.intervalSeconds
+         << ",\"counters\":{";
+    for (std::size_t c = 0; c < COUNTER_COUNT; c++) {
+        out_ << (c ? "," : "") << '"' << counterToString(static_cast<Counter>(c)) << "\":{\"total\":"
+             << snapshot.totals[c] << ",\"per_sec\":" << snapshot.ratesPerSecond[c] << '}';
+    }
+    out_ << "},\"latency_ns\":{";
+    for (std::size_t s = 0; s < STAGE_COUNT; s++) {
+        const LatencySummary& l = snapshot.latency[s];
+        out_ << (s ? "," : "") << '"' << stageToString(static_cast<Stage>(s)) << "\":{\"count\":" << l.count
+             << ",\"min\":" << l.min << ",\"mean\":" << l.mean << ",\"p50\":" << l.p50 << ",\"p90\":" << l.p90
+             << ",\"p99\":" << l.p99 << ",\"p999\":" << l.p999 << ",\"max\":" << l.max << '}';
+    }
+    out_ << "}}\n";
+}
+
+void MetricsExporter::writeCsv(const MetricsSnapshot& snapshot) {
+    out_ << snapshot.timestampMillis << ',' << snapshot.intervalSeconds;
+    for (std::size_t c = 0; c < COUNTER_COUNT; c++) {
+        out_ << ',' << snapshot.totals[c] << ',' << snapshot.ratesPerSecond[c];
+    }
+    for (const LatencySummary& l : snapshot.latency) {
+        out_ << ',' << l.count << ',' << l.min << ',' << l.mean << ',' << l.p50 << ',' << l.p90
+             << ',' << l.p99 << ',' << l.p999 << ',' << l.max;
+    }
+    out_ << '\n';
+}
+
+} // namespace loadtest
@@ -0,0 +1,272 @@
+#include "producer.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace loadtest {
+
+namespace {
+
+using Clock = TokenBucket::Clock;
+
+int64_t toNanos(Clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+// Sleep for long gaps, spin-yield for short ones to keep pacing accurate
+void waitUntil(Clock::time_point target) {
+    auto remaining = target - Clock::now();
+    if (remaining > std::chrono::microseconds(200)) {
+        std::this_thread::sleep_for(remaining - std::chrono::microseconds(100));
+    } else if (remaining > Clock::duration::zero()) {
+        std::this_thread::yield();
+    }
+}
+
+// Sends one batch; with metrics on, records the sink call and every
+// record's end-to-end latency against its intended send time. False when
+// the sink refused it.
+bool sendBatch(RecordSink& sink, const RecordBatch& batch, ThreadRecorder* recorder) {
+    if (!recorder) {
+        return sink.send(batch);
+    }
+    int64_t begin = toNanos(Clock::now());
+    if (!sink.send(batch)) {
+        return false;
+    }
+    int64_t end = toNanos(Clock::now());
+    recorder->record(Stage::SEND, static_cast<uint64_t>(end - begin));
+    for (const auto& record : batch.records()) {
+        recorder->record(Stage::END_TO_END, end > record.intendedNanos ? static_cast<uint64_t>(end - record.intendedNanos) : 0);
+    }
+    recorder->add(Counter::RECORDS_SENT, batch.size());
+    recorder->add(Counter::BATCHES_SENT, 1);
+    recorder->add(Counter::BYTES_SENT, batch.wireBytes());
+    return true;
+}
+
+// Sender thread for useAsync: sends batches in order and recycles them.
+// Raises `stopping` when the sink refuses a batch.
+class AsyncSender {
+public:
+    AsyncSender(RecordSink& sink, BufferPool& pool, std::shared_ptr<ThreadRecorder> recorder,
+                std::atomic<bool>& stopping)
+        : sink_(sink), pool_(pool), recorder_(std::move(recorder)), stopping_(stopping), done_(false),
+          thread_([this] { loop(); }) {}
+
+    ~AsyncSender() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_ = true;
+        }
+        ready_.notify_one();
+        thread_.join();
+    }
+
+    void submit(RecordBatch* batch) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back(batch);
+        }
+        ready_.notify_one();
+    }
+
+private:
+    void loop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            ready_.wait(lock, [this] { return done_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;
+            }
+            RecordBatch* batch = queue_.front();
+            queue_.pop_front();
+            lock.unlock();
+            if (!sendBatch(sink_, *batch, recorder_.get())) {
+                stopping_.store(true, std::memory_order_relaxed);
+            }
+            pool_.release(batch);
+            lock.lock();
+        }
+    }
+
+    RecordSink& sink_;
+    BufferPool& pool_;
+    std::shared_ptr<ThreadRecorder> recorder_;
+    std::atomic<bool>& stopping_;
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<RecordBatch*> queue_;
+    bool done_;
+    std::thread thread_;
+};
+
+}
+
+bool CountingSink::send(const RecordBatch& batch) {
+    records_.fetch_add(batch.size(), std::memory_order_relaxed);
+    batches_.fetch_add(1, std::memory_order_relaxed);
+    bytes_.fetch_add(batch.bytes(), std::memory_order_relaxed);
+    return true;
+}
+
+ProducerEngine::ProducerEngine(const Producer& config, std::shared_ptr<RecordSink> sink)
+    : config_(config), sink_(std::move(sink)), stopping_(false) {
+    if (!sink_) {
+        throw std::invalid_argument("ProducerEngine: sink is required");
+    }
+    if (config_.parallelism < 1 || config_.batchCount < 1) {
+        throw std::invalid_argument("ProducerEngine: parallelism and batchCount must be at least 1");
+    }
+    if (config_.messageSize == 0 || config_.messageSize > std::numeric_limits<uint32_t>::max()) {
+        throw std::invalid_argument("ProducerEngine: messageSize must be between 1 byte and 4 GiB");
+    }
+    createCodec(config_.compression);  // reject unknown codecs up front
+    if (config_.staticValue) {
+        staticPayload_ = config_.staticContent.empty() ? std::string(config_.messageSize, 'x') : config_.staticContent;
+    }
+}
+
+ProducerStats ProducerEngine::run(std::chrono::milliseconds duration) {
+    stopping_.store(false, std::memory_order_relaxed);
+    int workers = config_.parallelism;
+    std::vector<ProducerStats> results(workers);
+    std::vector<std::thread> threads;
+
+    auto start = Clock::now() + std::chrono::milliseconds(1);  // let every worker get scheduled first
+    auto deadline = start + duration;
+    uint64_t total = config_.count > 0 ? static_cast<uint64_t>(config_.count) : std::numeric_limits<uint64_t>::max();
+    for (int i = 0; i < workers; i++) {
+        // Split rate and record quota evenly, remainder to the first workers
+        uint64_t rate = config_.throughput / workers + (static_cast<uint64_t>(i) < config_.throughput % workers ? 1 : 0);
+        if (config_.throughput > 0 && rate == 0) {
+            rate = 1;
+        }
+        uint64_t quota = total == std::numeric_limits<uint64_t>::max()
+                       ? total : total / workers + (static_cast<uint64_t>(i) < total % workers ? 1 : 0);
+        threads.emplace_back(&ProducerEngine::runWorker, this, rate, quota, start, deadline, std::ref(results[i]));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = Clock::now();
+
+    ProducerStats stats;
+    for (const auto& result : results) {
+        stats.records += result.records;
+        stats.batches += result.batches;
+        stats.bytes += result.bytes;
+        stats.wireBytes += result.wireBytes;
+        stats.compression.merge(result.compression);
+        stats.maxLagNanos = std::max(stats.maxLagNanos, result.maxLagNanos);
+    }
+    stats.seconds = std::chrono::duration<double>(end - start).count();
+    return stats;
+}
+
+void ProducerEngine::runWorker(uint64_t rate, uint64_t quota, Clock::time_point start,
+                               Clock::time_point deadline, ProducerStats& stats) {
+    const std::size_t batchCount = config_.batchCount;
+    const uint32_t messageSize = static_cast<uint32_t>(config_.messageSize);
+    const std::size_t maxBatchBytes = config_.maxBytes > 0 ? config_.maxBytes : std::numeric_limits<std::size_t>::max();
+    const std::size_t recordBytes = config_.staticValue ? staticPayload_.size() : messageSize;
+    const auto linger = std::chrono::duration_cast<std::chrono::nanoseconds>(config_.lingerMs).count();
+    std::size_t poolBatches = std::max<std::size_t>(2, config_.maxBufferedRecords > 0
+                                                       ? config_.maxBufferedRecords / batchCount : 2);
+
+    BufferPool pool(poolBatches, batchCount, config_.staticValue ? 0 : batchCount * messageSize);
+    CompressionStage compression(config_.compression);
+    // Recorders are per thread: the async sender gets its own
+    std::shared_ptr<ThreadRecorder> recorder = metrics_ ? metrics_->createRecorder() : nullptr;
+    std::unique_ptr<AsyncSender> sender;
+    if (config_.useAsync) {
+        sender = std::make_unique<AsyncSender>(*sink_, pool, metrics_ ? metrics_->createRecorder() : nullptr,
+                                               stopping_);
+    }
+    TokenBucket bucket(rate, start);
+    uint64_t produced = 0;
+
+    auto dispatch = [&](RecordBatch* batch) {
+        uint64_t compressNanos = compression.process(*batch);
+        if (recorder && compression.isEnabled()) {
+            recorder->record(Stage::COMPRESS, compressNanos);
+        }
+        stats.batches++;
+        stats.records += batch->size();
+        stats.bytes += batch->bytes();
+        stats.wireBytes += batch->wireBytes();
+        if (sender) {
+            sender->submit(batch);
+        } else {
+            if (!sendBatch(*sink_, *batch, recorder.get())) {
+                stop();
+            }
+            pool.release(batch);
+        }
+    };
+
+    waitUntil(start);
+    RecordBatch* batch = pool.acquire();
+    while (produced < quota && !stopping_.load(std::memory_order_relaxed)) {
+        auto now = Clock::now();
+        if (now >= deadline) {
+            break;
+        }
+        // Records that still fit under maxBytes; an empty batch always
+        // takes one, even if that record alone is larger
+        uint64_t byteRoom = batch->bytes() >= maxBatchBytes ? 0 : (maxBatchBytes - batch->bytes()) / recordBytes;
+        if (batch->empty()) {
+            byteRoom = std::max<uint64_t>(byteRoom, 1);
+        }
+        uint64_t room = std::min<uint64_t>({batchCount - batch->size(), quota - produced, byteRoom});
+        uint64_t due = bucket.available(now, room);
+        if (due > 0) {
+            uint64_t first = bucket.take(due);
+            int64_t nowNanos = toNanos(now);
+            for (uint64_t k = 0; k < due; k++) {
+                int64_t intended = bucket.isPaced() ? toNanos(bucket.intendedTime(first + k)) : nowNanos;
+                if (config_.staticValue) {
+                    batch->addReference(staticPayload_.data(), static_cast<uint32_t>(staticPayload_.size()), intended);
+                } else {
+                    char* payload = batch->allocate(messageSize, intended);
+                    uint64_t sequence = produced + k;
+                    std::memcpy(payload, &sequence, std::min<std::size_t>(sizeof(sequence), messageSize));
+                }
+            }
+            if (bucket.isPaced()) {
+                stats.maxLagNanos = std::max(stats.maxLagNanos, nowNanos - toNanos(bucket.intendedTime(first)));
+            }
+            produced += due;
+        }
+
+        bool lingerExpired = !batch->empty() && toNanos(now) - batch->firstIntendedNanos() >= linger;
+        bool bytesFull = batch->bytes() >= maxBatchBytes || recordBytes > maxBatchBytes - batch->bytes();
+        if (batch->isFull() || bytesFull || lingerExpired || produced == quota) {
+            dispatch(batch);
+            batch = pool.acquire();
+            continue;
+        }
+        if (due == 0) {
+            auto wake = std::min(bucket.nextTokenTime(), deadline);
+            if (!batch->empty()) {
+                wake = std::min(wake, Clock::time_point(std::chrono::nanoseconds(batch->firstIntendedNanos() + linger)));
+            }
+            waitUntil(wake);
+        }
+    }
+    if (!batch->empty()) {
+        dispatch(batch);
+    } else {
+        pool.release(batch);
+    }
+    sender.reset();  // drains queued batches before the pool goes away
+    stats.compression = compression.getStats();
+}
+
+} // namespace loadtest
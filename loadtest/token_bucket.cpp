@@ -0,0 +1,34 @@
+#include "token_bucket.hpp"
+#include <algorithm>
+
+namespace loadtest {
+
+TokenBucket::TokenBucket(uint64_t ratePerSecond, Clock::time_point start)
+    : start_(start), intervalNanos_(ratePerSecond ? 1e9 / static_cast<double>(ratePerSecond) : 0.0), issued_(0) {}
+
+uint64_t TokenBucket::available(Clock::time_point now, uint64_t max) const {
+    if (!isPaced()) {
+        return max;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - start_).count();
+    if (elapsed < 0) {
+        return 0;
+    }
+    uint64_t due = static_cast<uint64_t>(static_cast<double>(elapsed) / intervalNanos_) + 1;
+    return due > issued_ ? std::min(due - issued_, max) : 0;
+}
+
+uint64_t TokenBucket::take(uint64_t count) {
+    uint64_t first = issued_;
+    issued_ += count;
+    return first;
+}
+
+TokenBucket::Clock::time_point TokenBucket::intendedTime(uint64_t token) const {
+    if (!isPaced()) {
+        return start_;
+    }
+    return start_ + std::chrono::nanoseconds(static_cast<int64_t>(static_cast<double>(token) * intervalNanos_));
+}
+
+} // namespace loadtest